@@ -26,6 +26,12 @@ if(NOT BUILD_TEST_EXAMPLES)
     )
 endif()
 
+if(NOT BUILD_TEST_PERF)
+    set(BUILD_TEST_PERF FALSE
+        CACHE BOOL "TRUE to build the performance benchmarks, FALSE otherwise."
+    )
+endif()
+
 if(NOT BUILD_TEST_LUA)
     set(BUILD_TEST_LUA FALSE
         CACHE BOOL "TRUE to build the Lua-specific tests (requires Lua), FALSE otherwise."
@@ -44,6 +50,18 @@ if(NOT USES_LUA)
     )
 endif()
 
+if(NOT PONDER_PROFILING)
+    set(PONDER_PROFILING FALSE
+        CACHE BOOL "TRUE to measure the calls to the reflected functions, FALSE otherwise."
+    )
+endif()
+
+if(NOT PONDER_NO_EXCEPTIONS)
+    set(PONDER_NO_EXCEPTIONS FALSE
+        CACHE BOOL "TRUE to build without exceptions, errors go to the error handler, FALSE otherwise."
+    )
+endif()
+
 if(NOT USES_RAPIDJSON)
     set(USES_RAPIDJSON TRUE
         CACHE BOOL "TRUE to include RapidJSON support, FALSE otherwise."
@@ -32,12 +32,22 @@
 #define PONDER_ARGS_HPP
 
 #include <ponder/config.hpp>
+#include <ponder/value.hpp>
 #include <vector>
 #include <initializer_list>
+#include <type_traits>
 
 namespace ponder {
 
-class Value;
+class Args;
+
+namespace detail {
+
+// True when V is a single Args, so that copies don't use the variadic constructor.
+template <typename... V> struct IsArgs : std::false_type {};
+template <typename V> struct IsArgs<V> : std::is_same<typename std::decay<V>::type, Args> {};
+
+} // namespace detail
 
 /**
  * \brief Wrapper for packing an arbitrary number of arguments into a single object
@@ -63,20 +73,71 @@ class Value;
  * args = args + myObject;
  * \endcode
  *
+ * Up to inlineCapacity arguments are stored inline, without a heap allocation. A slot is
+ * reserved in front of them so that inserting the object a member function is called on,
+ * at index 0, doesn't move the other arguments.
  */
 class PONDER_API Args
 {
 public:
 
+    /**
+     * \brief Number of arguments stored without a heap allocation
+     */
+    static constexpr size_t inlineCapacity = 6;
+
+    /**
+     * \brief Construct an empty list
+     */
+    Args() {}
+
+    /**
+     * \brief Copy constructor
+     *
+     * \param other List to copy
+     */
+    Args(const Args& other);
+
+    /**
+     * \brief Move constructor
+     *
+     * \param other List to move, left empty
+     */
+    Args(Args&& other) noexcept;
+
+    /**
+     * \brief Destructor
+     */
+    ~Args();
+
+    /**
+     * \brief Assignment operator
+     *
+     * \param other List to copy
+     * \return Reference to this
+     */
+    Args& operator = (const Args& other);
+
+    /**
+     * \brief Move assignment operator
+     *
+     * \param other List to move, left empty
+     * \return Reference to this
+     */
+    Args& operator = (Args&& other) noexcept;
+
     /**
      * \brief Construct the list with variable arguments.
      *
+     * The arguments are moved in when they are rvalues.
+     *
      * \param args Parameter pack to be used.
      */
-    template <typename... V>
+    template <typename... V, typename = typename std::enable_if<!detail::IsArgs<V...>::value>::type>
     Args(V&&... args)
-    :   Args(std::initializer_list<Value>({std::forward<V>(args)...}))
     {
+        reserve(sizeof...(V));
+        (append(Value(std::forward<V>(args))), ...);
     }
     
     /**
@@ -86,7 +147,9 @@ public:
      */
     Args(std::initializer_list<Value> il)
     {
-        m_values = il;
+        reserve(il.size());
+        for (auto& value : il)
+            append(Value(value));
     }
 
     /**
@@ -94,7 +157,7 @@ public:
      *
      * \return Size of the arguments list
      */
-    size_t count() const;
+    size_t count() const {return m_count;}
 
     /**
      * \brief Overload of operator [] to access an argument from its index
@@ -111,7 +174,17 @@ public:
      * \param arg Argument to concatenate to the list
      * \return New list
      */
-    Args operator + (const Value& arg) const;
+    Args operator + (const Value& arg) const &;
+
+    /**
+     * \brief Overload of operator + to concatenate a list and a new argument
+     *
+     * The list is moved into the result rather than copied.
+     *
+     * \param arg Argument to concatenate to the list
+     * \return New list
+     */
+    Args operator + (const Value& arg) &&;
 
     /**
      * \brief Overload of operator += to append a new argument to the list
@@ -120,16 +193,36 @@ public:
      * \return Reference to this
      */
     Args& operator += (const Value& arg);
+
+    /**
+     * \brief Overload of operator += to move a new argument to the end of the list
+     *
+     * \param arg Argument to append to the list
+     * \return Reference to this
+     */
+    Args& operator += (Value&& arg);
     
     /**
      * \brief Insert an argument into the list at a given index
      *
+     * Inserting at index 0 uses the reserved slot, unless it is already taken.
+     *
      * \param index Index at which to insert the argument
      * \param arg Argument to append to the list
      * \return Reference to this
      */
     Args& insert(size_t index, const Value& arg);
 
+    /**
+     * \brief Replace an argument of the list
+     *
+     * \param index Index of the argument to replace
+     * \param arg New value of the argument
+     * \return Reference to this
+     * \throw OutOfRange index is out of range
+     */
+    Args& set(size_t index, const Value& arg);
+
 public:
 
     /**
@@ -139,7 +232,25 @@ public:
 
 private:
 
-    std::vector<Value> m_values; // List of the values
+    Value* slots() {return reinterpret_cast<Value*>(m_inline);}
+    const Value* slots() const {return reinterpret_cast<const Value*>(m_inline);}
+    Value* values() {return m_isInline ? slots() + m_first : m_heap.data();}
+    const Value* values() const {return m_isInline ? slots() + m_first : m_heap.data();}
+
+    void reserve(size_t count);
+    void append(Value&& arg);
+    void moveToHeap(size_t capacity);
+    void clear();
+    void copyFrom(const Args& other);
+    void moveFrom(Args&& other);
+
+    // Storage for the inline values, the first slot is reserved. Only the used slots hold
+    // constructed values.
+    alignas(Value) unsigned char m_inline[(1 + inlineCapacity) * sizeof(Value)];
+    std::vector<Value> m_heap; // Values, when they don't fit inline
+    size_t m_first = 1; // Index of the first inline value
+    size_t m_count = 0; // Number of values
+    bool m_isInline = true; // Are the values in m_inline or m_heap?
 };
 
 } // namespace ponder
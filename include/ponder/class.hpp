@@ -36,8 +36,13 @@
 #include <ponder/property.hpp>
 #include <ponder/function.hpp>
 #include <ponder/userobject.hpp>
+#include <ponder/memberhandle.hpp>
+#include <ponder/hashedid.hpp>
 #include <ponder/detail/typeid.hpp>
 #include <ponder/detail/dictionary.hpp>
+#include <ponder/detail/integerindex.hpp>
+#include <ponder/detail/objectpool.hpp>
+#include <ponder/detail/constructorcache.hpp>
 #include <string>
 #include <map>
 
@@ -105,14 +110,22 @@ class PONDER_API Class : public Type
     typedef UserObject (*UserObjectCreator)(void*);
     
     size_t m_sizeof;                // Size of the class in bytes.
+    size_t m_index;                 // Dense index of the metaclass
     TypeId m_id;                    // Unique type id of the metaclass.
     Id m_name;                      // Name of the metaclass
     FunctionTable m_functions;      // Table of metafunctions indexed by ID
     PropertyTable m_properties;     // Table of metaproperties indexed by ID
     BaseList m_bases;               // List of base metaclasses
+    BaseList m_ancestors;           // All base metaclasses, flattened, in search order
+    detail::IntegerIndex<size_t> m_ancestorIndex; // Position in m_ancestors by class index
     ConstructorList m_constructors; // List of metaconstructors
+    detail::ConstructorCache m_constructorCache; // Constructors by arity, cached resolution
     Destructor m_destructor;        // Destructor (function able to delete an abstract object)
     UserObjectCreator m_userObjectCreator; // Convert pointer of class instance to UserObject
+    bool m_frozen;                  // Declaration complete, lookups indexed
+    detail::ObjectPool* m_objectPool; // Default storage of owned objects
+    std::pmr::memory_resource* m_objectResource; // Storage of owned objects
+    std::vector<detail::ClassCacheSlot*> m_cacheSlots; // Per type caches of this class
 
 public: // declaration
 
@@ -159,6 +172,20 @@ public: // reflection
      */
     IdReturn name() const;
 
+    /**
+     * \brief Return the index of the metaclass
+     *
+     * Each registered metaclass has a small unique index, less than ponder::classIndexCount().
+     * This can be used to index flat per class tables instead of using maps.
+     *
+     * \note The index of an undeclared metaclass may be reused by a new metaclass.
+     *
+     * \return Index of the metaclass
+     *
+     * \see ponder::classByIndex
+     */
+    size_t index() const;
+
     /**
      * \brief Return the total number of base metaclasses of this metaclass
      *
@@ -176,6 +203,29 @@ public: // reflection
      */
     const Class& base(size_t index) const;
 
+    /**
+     * \brief Check if this metaclass is, or inherits from, another metaclass
+     *
+     * All the bases of a metaclass are indexed when they are declared so this is one table
+     * probe, regardless of the depth of the hierarchy.
+     *
+     * \param base Metaclass to check against
+     *
+     * \return True if \a base is this metaclass or one of its direct or indirect bases
+     */
+    bool isA(const Class& base) const;
+
+    /**
+     * \brief Check if this metaclass is, or is a base of, another metaclass
+     *
+     * \param derived Metaclass to check against
+     *
+     * \return True if this metaclass is \a derived or one of its direct or indirect bases
+     *
+     * \see isA
+     */
+    bool isBaseOf(const Class& derived) const;
+
     /**
      * \brief Return the total number of constructors of this metaclass
      *
@@ -191,6 +241,19 @@ public: // reflection
      * \return Constructor
      */
     const Constructor* constructor(size_t index) const;
+
+    /**
+     * \brief Find the constructor to use for a set of arguments
+     *
+     * This is the first declared constructor which matches the arguments. The result is
+     * cached for each distinct signature of arguments (kinds, metaclasses and metaenums), so
+     * further calls with the same signature don't match the constructors again.
+     *
+     * \param args Arguments to pass to the constructor
+     *
+     * \return Constructor, or null if none matches the arguments
+     */
+    const Constructor* findConstructor(const Args& args) const;
     
     /**
      * \brief Destroy a UserObject instance
@@ -216,6 +279,14 @@ public: // reflection
      */
     bool hasFunction(IdRef name) const;
 
+    /**
+     * \brief Check if this metaclass contains the given function
+     *
+     * \param name Name of the function to check, hashed at compile time
+     * \return True if the function is in the metaclass, false otherwise
+     */
+    bool hasFunction(HashedId name) const;
+
     /**
      * \brief Get a function from its index in this metaclass
      *
@@ -238,6 +309,43 @@ public: // reflection
      */
     const Function& function(IdRef name) const;
 
+    /**
+     * \brief Get a function from its name, hashed at compile time
+     *
+     * \param name Name of the function to get, e.g. `"foo"_pid`
+     *
+     * \return Reference to the function
+     *
+     * \throw FunctionNotFound \a name is not a function of the metaclass
+     */
+    const Function& function(HashedId name) const;
+
+    /**
+     * \brief Get a handle to a function, for access without name lookup
+     *
+     * \param name Name of the function (case sensitive)
+     * \return Handle to the function
+     *
+     * \throw FunctionNotFound \a name is not a function of the metaclass
+     *
+     * \see function(FunctionHandle)
+     */
+    FunctionHandle functionHandle(IdRef name) const;
+
+    /**
+     * \brief Get a function from a handle
+     *
+     * \param handle Handle obtained from this metaclass, or one of its bases
+     * \return Reference to the function
+     *
+     * \throw ClassUnrelated \a handle belongs to a metaclass which isn't a base of this one
+     * \throw OutOfRange \a handle is out of date, the metaclass was modified
+     *
+     * \note A handle from a base metaclass gives the base's function, even if this
+     *       metaclass declares one with the same name
+     */
+    const Function& function(FunctionHandle handle) const;
+
     /**
      * \brief Get a function iterator
      *
@@ -265,6 +373,15 @@ public: // reflection
      */
     bool tryFunction(const IdRef name, const Function*& funcRet) const;
 
+    /**
+     * \brief Look up a function by name, hashed at compile time, and return success
+     *
+     * \param name Name of the function to get, e.g. `"foo"_pid`
+     * \param funcRet Function returned, if return was true
+     * \return Boolean. True if function found, else if not, false
+     */
+    bool tryFunction(HashedId name, const Function*& funcRet) const;
+
     /**
      * \brief Return the total number of properties of this metaclass
      *
@@ -280,6 +397,14 @@ public: // reflection
      */
     bool hasProperty(IdRef name) const;
 
+    /**
+     * \brief Check if this metaclass contains the given property
+     *
+     * \param name Name of the property to check, hashed at compile time
+     * \return True if the property is in the metaclass, false otherwise
+     */
+    bool hasProperty(HashedId name) const;
+
     /**
      * \brief Get a property from its index in this metaclass
      *
@@ -299,6 +424,48 @@ public: // reflection
      * \throw PropertyNotFound \a name is not a property of the metaclass
      */
     const Property& property(IdRef name) const;
+
+    /**
+     * \brief Get a property from its name, hashed at compile time
+     *
+     * \param name Name of the property to get, e.g. `"bar"_pid`
+     * \return Reference to the property
+     *
+     * \throw PropertyNotFound \a name is not a property of the metaclass
+     */
+    const Property& property(HashedId name) const;
+
+    /**
+     * \brief Get a handle to a property, for access without name lookup
+     *
+     * \param name Name of the property (case sensitive)
+     * \return Handle to the property
+     *
+     * \throw PropertyNotFound \a name is not a property of the metaclass
+     *
+     * \code
+     * const ponder::PropertyHandle x = ponder::classByType<Vec>().propertyHandle("x");
+     * for (auto& obj : objects)
+     *     obj.set(x, obj.get(x).to<float>() + 1.f);
+     * \endcode
+     *
+     * \see property(PropertyHandle), UserObject::get(PropertyHandle)
+     */
+    PropertyHandle propertyHandle(IdRef name) const;
+
+    /**
+     * \brief Get a property from a handle
+     *
+     * \param handle Handle obtained from this metaclass, or one of its bases
+     * \return Reference to the property
+     *
+     * \throw ClassUnrelated \a handle belongs to a metaclass which isn't a base of this one
+     * \throw OutOfRange \a handle is out of date, the metaclass was modified
+     *
+     * \note A handle from a base metaclass gives the base's property, even if this
+     *       metaclass declares one with the same name
+     */
+    const Property& property(PropertyHandle handle) const;
     
     /**
      * \brief Get a property iterator
@@ -326,6 +493,15 @@ public: // reflection
      * \endcode
      */
     bool tryProperty(const IdRef name, const Property*& propRet) const;
+
+    /**
+     * \brief Look up a property by name, hashed at compile time, and return success
+     *
+     * \param name Name of the property to get, e.g. `"bar"_pid`
+     * \param propRet Property returned, if return was true
+     * \return Boolean. True if property found, else if not, false
+     */
+    bool tryProperty(HashedId name, const Property*& propRet) const;
     
     /**
      * \brief Return the memory size of a class instance
@@ -334,6 +510,29 @@ public: // reflection
      */
     size_t sizeOf() const;
 
+    /**
+     * \brief Return the memory resource used to store objects owned by user objects
+     *
+     * Owned objects (UserObject::makeCopy(), UserObject::makeOwned() and objects
+     * created by constructors) are allocated from it, together with their holder, in a
+     * single allocation. By default this is a pool for this class, see
+     * ClassBuilder::memoryResource().
+     *
+     * \return Memory resource
+     */
+    std::pmr::memory_resource* memoryResource() const;
+
+    /**
+     * \brief Check if the metaclass has been frozen
+     *
+     * A frozen metaclass has indexed lookups and can no longer be modified.
+     *
+     * \return True if frozen
+     *
+     * \see ClassBuilder::freeze, ponder::freezeClasses
+     */
+    bool isFrozen() const;
+
     /**
      * \brief Create a UserObject from an opaque user pointer
      *
@@ -400,10 +599,26 @@ private:
 
     Class(TypeId const& id, IdRef name);
 
+    ~Class();
+
+    // Set the size of the C++ class, creating the pool for its objects.
+    void setSizeOf(size_t size);
+
+    // Index the member tables and disallow further modification.
+    void freeze();
+
+    // Add a direct base metaclass, merging its ancestors into the ancestor table.
+    void addBase(const Class& base, int offset);
+
     /* Get the offset of a base metaclass
      * - offset between this and base, or -1 if both classes are unrelated
      */
     int baseOffset(const Class& base) const;
+
+    // Resolve a handle which isn't a valid slot of this metaclass: a handle from a base
+    // metaclass gives the base's member, anything else raises an error.
+    const Function& functionFromHandle(FunctionHandle handle) const;
+    const Property& propertyFromHandle(PropertyHandle handle) const;
     
 };
 
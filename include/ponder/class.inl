@@ -55,9 +55,10 @@ inline ClassBuilder<T> Class::declare(IdRef name)
     Class& newClass =
         detail::ClassManager::instance()
             .addClass(typeDecl::id(false), name.empty() ? typeDecl::name(false) : name);
-    newClass.m_sizeof = sizeof(T);
+    newClass.setSizeOf(sizeof(T));
     newClass.m_destructor = &detail::destroy<T>;
     newClass.m_userObjectCreator = &detail::userObjectCreator<T>;
+    detail::ClassManager::instance().bindCache(newClass, detail::ClassCache<T>::slot);
     return ClassBuilder<T>(newClass);
 }
 
@@ -67,6 +68,20 @@ inline void Class::undeclare()
     detail::ClassManager::instance().removeClass(detail::getTypeId<T>());
 }
 
+inline const Function& Class::function(FunctionHandle handle) const
+{
+    if (handle.getClass() != this || handle.index() >= m_functions.size())
+        return functionFromHandle(handle);
+    return *m_functions.at(handle.index())->second;
+}
+
+inline const Property& Class::property(PropertyHandle handle) const
+{
+    if (handle.getClass() != this || handle.index() >= m_properties.size())
+        return propertyFromHandle(handle);
+    return *m_properties.at(handle.index())->second;
+}
+
 inline Class::FunctionView Class::functions() const
 {
     return FunctionView(m_functions.begin(), m_functions.end());
@@ -83,6 +98,17 @@ inline bool Class::tryFunction(const IdRef name, const Function *& funcRet) cons
     return false;
 }
 
+inline bool Class::tryFunction(HashedId name, const Function *& funcRet) const
+{
+    FunctionTable::const_iterator it = m_functions.findHashed(name.name(), name.hash());
+    if (it != m_functions.end())
+    {
+        funcRet = it->value().get();
+        return true;
+    }
+    return false;
+}
+
 inline Class::PropertyView Class::properties() const
 {
     return PropertyView(m_properties.begin(), m_properties.end());
@@ -99,6 +125,17 @@ inline bool Class::tryProperty(const IdRef name, const Property *& propRet) cons
     return false;
 }
 
+inline bool Class::tryProperty(HashedId name, const Property *& propRet) const
+{
+    PropertyTable::const_iterator it = m_properties.findHashed(name.name(), name.hash());
+    if (it != m_properties.end())
+    {
+        propRet = it->value().get();
+        return true;
+    }
+    return false;
+}
+
 inline UserObject Class::getUserObjectFromPointer(void* ptr) const
 {
     return m_userObjectCreator(ptr);
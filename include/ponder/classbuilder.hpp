@@ -71,6 +71,14 @@ public:
      */
     ClassBuilder(Class& target);
 
+    /**
+     * \brief Destructor, completes the declaration
+     *
+     * Members added by the builder are sorted into the metaclass tables here, or by
+     * freeze(), so lookups never modify them. Until then lookups don't see the members.
+     */
+    ~ClassBuilder();
+
     /**
      * \brief Declare a base metaclass
      *
@@ -82,6 +90,9 @@ public:
      * \note We *do not* support virtual inheritance fully here due to the associated problems
      *       with compiler specific class layouts. e.g. see Class::applyOffset.
      *
+     * \note The bases of U are copied into the ancestor table of T, so they should be
+     *       declared before U is used as a base.
+     *
      * \return Reference to this, in order to chain other calls
      *
      * \throw ClassNotFound no metaclass is bound to U
@@ -155,6 +166,37 @@ public:
     template <typename F1, typename F2>
     ClassBuilder<T>& property(IdRef name, F1 accessor1, F2 accessor2);
 
+    /**
+     * \brief Declare a new property from accessors given as template arguments
+     *
+     * This works as property(IdRef, F) and property(IdRef, F1, F2) with a getter and setter,
+     * but the accessors are compile time constants: the generated property calls them
+     * directly, without storing a pointer or std::function, so the access can be inlined.
+     *
+     * Example:
+     *
+     * \code
+     * struct Point
+     * {
+     *     float x, y;
+     *
+     *     float length() const;
+     *     void setLength(float);
+     * };
+     *
+     * ponder::Class::declare<Point>("Point")
+     *     .property<&Point::x>("x")                                 // getter + setter
+     *     .property<&Point::length, &Point::setLength>("length");   // getter, setter
+     * \endcode
+     *
+     * \tparam Accessor Getter, or pointer-to-member (considered both a getter and a setter)
+     * \tparam Setter Optional setter
+     * \param name Name of the property (must be unique within the metaclass)
+     * \return Reference to this, in order to chain other calls
+     */
+    template <auto Accessor, auto Setter = nullptr>
+    ClassBuilder<T>& property(IdRef name);
+
     /**
      * \brief Declare a new function from any bindable type
      *
@@ -172,6 +214,25 @@ public:
     template <typename F, typename... P>
     ClassBuilder<T>& function(IdRef name, F function, P... policies);
 
+    /**
+     * \brief Declare a new function given as a template argument
+     *
+     * This works as function(IdRef, F, P...), but the function is a compile time
+     * constant which is called directly, so the call can be inlined.
+     *
+     * \code
+     * ponder::Class::declare<MyClass>("MyClass")
+     *     .function<&MyClass::foo>("foo");
+     * \endcode
+     *
+     * \tparam Fn Non-member or member function to bind to the function
+     * \param name Name of the function (must be unique within the metaclass)
+     * \param policies Optional policies applied to function exposer
+     * \return Reference to this, in order to chain other calls
+     */
+    template <auto Fn, typename... P>
+    ClassBuilder<T>& function(IdRef name, P... policies);
+
     /**
      * \brief Declare a constructor for the metaclass.
      * 
@@ -242,13 +303,51 @@ public:
         return *this;
     }
 
+    /**
+     * \brief Set the memory resource used to store objects of the metaclass
+     *
+     * Owned user objects of the class are allocated from this resource. By default each
+     * metaclass has its own pool, drawing from `std::pmr::get_default_resource()`.
+     *
+     * \code
+     * std::pmr::unsynchronized_pool_resource pool;
+     * ponder::Class::declare<MyClass>("MyClass")
+     *     .memoryResource(&pool);
+     * \endcode
+     *
+     * \param resource Resource to allocate from, or nullptr for the default pool. The
+     *                 resource must outlive all objects allocated from it.
+     *
+     * \return Reference to this, in order to chain other calls
+     */
+    ClassBuilder<T>& memoryResource(std::pmr::memory_resource* resource);
+
+    /**
+     * \brief Freeze the metaclass, ending its declaration
+     *
+     * Property and function lookups by name are compiled into perfect hash indexes, so
+     * each lookup is a single hash and compare. Once frozen the metaclass can no longer
+     * be modified, any attempt will throw.
+     *
+     * \code
+     * ponder::Class::declare<MyClass>("MyClass")
+     *     .property("prop", &MyClass::prop)
+     *     .freeze();
+     * \endcode
+     *
+     * \see ponder::freezeClasses
+     */
+    void freeze();
+
 private:
 
     ClassBuilder<T>& addProperty(Property* property);
     ClassBuilder<T>& addFunction(Function* function);
+    void checkNotFrozen() const;
 
     Class* m_target; // Target metaclass to fill
     Type* m_currentType; // Last member type which has been declared
+    size_t m_classIndex; // Index of the target, to check it still exists when done
 };
 
 } // namespace ponder
@@ -33,13 +33,28 @@ template <typename T>
 ClassBuilder<T>::ClassBuilder(Class& target)
     : m_target(&target)
     , m_currentType(&target)
+    , m_classIndex(target.index())
 {
 }
 
+template <typename T>
+ClassBuilder<T>::~ClassBuilder()
+{
+    // The metaclass may have been undeclared while the builder was kept, so check it is
+    // still registered before touching it.
+    if (classByIndex(m_classIndex) == m_target)
+    {
+        m_target->m_properties.flush();
+        m_target->m_functions.flush();
+    }
+}
+
 template <typename T>   // class
 template <typename U>   // base
 ClassBuilder<T>& ClassBuilder<T>::base()
 {
+    checkNotFrozen();
+
     // Retrieve the base metaclass and its name
     const Class& baseClass = classByType<U>();
     IdReturn baseName = baseClass.name();
@@ -64,21 +79,19 @@ ClassBuilder<T>& ClassBuilder<T>::base()
                                         reinterpret_cast<char*>(asDerived));
     
     // Add the base metaclass to the bases of the current class
-    Class::BaseInfo baseInfos;
-    baseInfos.base = &baseClass;
-    baseInfos.offset = offset;
-    m_target->m_bases.push_back(baseInfos);
+    m_target->addBase(baseClass, offset);
 
-    // Copy all properties of the base class into the current class
+    // Copy all properties and functions of the base class into the current class. The
+    // entries are shared pointers so the metaproperties are shared, not duplicated. The
+    // inserts are deferred and sorted into the tables once, when the builder is done.
     for (auto&& it = baseClass.m_properties.begin(); it != baseClass.m_properties.end(); ++it)
     {
-        m_target->m_properties.insert(it);
+        m_target->m_properties.insertDeferred(it->first, it->second);
     }
 
-    // Copy all functions of the base class into the current class
     for (auto&& it = baseClass.m_functions.begin(); it != baseClass.m_functions.end(); ++it)
     {
-        m_target->m_functions.insert(it);
+        m_target->m_functions.insertDeferred(it->first, it->second);
     }
 
     return *this;
@@ -88,6 +101,7 @@ template <typename T>
 template <typename F>
 ClassBuilder<T>& ClassBuilder<T>::property(IdRef name, F accessor)
 {
+    checkNotFrozen();
     return addProperty(detail::PropertyFactory1<T, F>::create(name, accessor));
 }
 
@@ -95,23 +109,44 @@ template <typename T>
 template <typename F1, typename F2>
 ClassBuilder<T>& ClassBuilder<T>::property(IdRef name, F1 accessor1, F2 accessor2)
 {
+    checkNotFrozen();
     return addProperty(detail::PropertyFactory2<T, F1, F2>::create(name, accessor1, accessor2));
 }
 
+template <typename T>
+template <auto Accessor, auto Setter>
+ClassBuilder<T>& ClassBuilder<T>::property(IdRef name)
+{
+    checkNotFrozen();
+    return addProperty(detail::StaticPropertyFactory<T, Accessor, Setter>::create(name));
+}
+
 template <typename T>
 template <typename F, typename... P>
 ClassBuilder<T>& ClassBuilder<T>::function(IdRef name, F function, P... policies)
 {
+    checkNotFrozen();
+
     // Construct and add the metafunction
     return addFunction(detail::newFunction(name, function, policies...));
 }
 
+template <typename T>
+template <auto Fn, typename... P>
+ClassBuilder<T>& ClassBuilder<T>::function(IdRef name, P... policies)
+{
+    checkNotFrozen();
+    return addFunction(detail::newFunction<Fn>(name, policies...));
+}
+
 template <typename T>
 template <typename... A>
 ClassBuilder<T>& ClassBuilder<T>::constructor()
 {
+    checkNotFrozen();
     Constructor* constructor = new detail::ConstructorImpl<T, A...>();
     m_target->m_constructors.push_back(Class::ConstructorPtr(constructor));
+    m_target->m_constructorCache.add(constructor, sizeof...(A));
     return *this;
 }
 
@@ -119,6 +154,8 @@ template <typename T>
 template <template <typename> class U>
 ClassBuilder<T>& ClassBuilder<T>::external()
 {
+    checkNotFrozen();
+
     // Create an instance of the mapper
     U<T> mapper;
 
@@ -138,14 +175,8 @@ ClassBuilder<T>& ClassBuilder<T>::external()
 template <typename T>
 ClassBuilder<T>& ClassBuilder<T>::addProperty(Property* property)
 {
-    // Retrieve the class' properties indexed by name
-    Class::PropertyTable& properties = m_target->m_properties;
-
-    // First remove any property that already exists with the same name
-    properties.erase(property->name());
-
-    // Insert the new property
-    properties.insert(property->name(), Class::PropertyPtr(property));
+    // Insert the new property, replacing any that already exists with the same name
+    m_target->m_properties.insertDeferred(property->name(), Class::PropertyPtr(property));
 
     m_currentType = property;
 
@@ -155,18 +186,33 @@ ClassBuilder<T>& ClassBuilder<T>::addProperty(Property* property)
 template <typename T>
 ClassBuilder<T>& ClassBuilder<T>::addFunction(Function* function)
 {
-    // Retrieve the class' functions indexed by name
-    Class::FunctionTable& functions = m_target->m_functions;
-
-    // First remove any function that already exists with the same name
-    functions.erase(function->name());
-
-    // Insert the new function
-    functions.insert(function->name(), Class::FunctionPtr(function));
+    // Insert the new function, replacing any that already exists with the same name
+    m_target->m_functions.insertDeferred(function->name(), Class::FunctionPtr(function));
 
     m_currentType = function;
 
     return *this;
 }
 
+template <typename T>
+ClassBuilder<T>& ClassBuilder<T>::memoryResource(std::pmr::memory_resource* resource)
+{
+    checkNotFrozen();
+    m_target->m_objectResource = resource ? resource : m_target->m_objectPool;
+    return *this;
+}
+
+template <typename T>
+void ClassBuilder<T>::freeze()
+{
+    m_target->freeze();
+}
+
+template <typename T>
+void ClassBuilder<T>::checkNotFrozen() const
+{
+    if (m_target->isFrozen())
+        PONDER_ERROR(ClassFrozen(m_target->name()));
+}
+
 } // namespace ponder
@@ -50,6 +50,17 @@ class Class;
  */
 PONDER_API void* classCast(void* pointer, const Class& sourceClass, const Class& targetClass);
 
+/**
+ * \brief Check if a pointer can be converted from a source metaclass to a target metaclass
+ *
+ * \param sourceClass Source metaclass to convert from
+ * \param targetClass Target metaclass to convert to
+ *
+ * \return True if classCast() succeeds: the metaclasses are the same, or one derives from
+ *         the other
+ */
+PONDER_API bool canClassCast(const Class& sourceClass, const Class& targetClass);
+
 } // namespace ponder
 
 #endif // PONDER_CLASSCAST_HPP
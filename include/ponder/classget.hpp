@@ -61,6 +61,42 @@ size_t classCount();
  */
 detail::ClassManager::ClassView classes();
 
+/**
+ * \brief Get the upper bound of metaclass indices
+ *
+ * All metaclass indices are less than this, so it can be used to size tables indexed by
+ * Class::index().
+ *
+ * \relates Class
+ *
+ * \return Metaclass index count
+ */
+size_t classIndexCount();
+
+/**
+ * \brief Get a metaclass from its index
+ *
+ * \relates Class
+ *
+ * \param index Index of the metaclass, see Class::index()
+ *
+ * \return Pointer to the metaclass, or nullptr if no metaclass has this index
+ */
+const Class* classByIndex(size_t index);
+
+/**
+ * \brief Freeze all registered metaclasses
+ *
+ * Call this once registration is complete. Property and function lookups by name are then
+ * compiled into perfect hash indexes and the metaclasses can no longer be modified.
+ * Metaclasses declared afterwards are not frozen.
+ *
+ * \relates Class
+ *
+ * \see ClassBuilder::freeze
+ */
+void freezeClasses();
+
 /**
  * \brief Get a metaclass from its name
  *
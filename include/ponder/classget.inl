@@ -39,6 +39,21 @@ inline detail::ClassManager::ClassView classes()
     return detail::ClassManager::instance().getClasses();
 }
 
+inline size_t classIndexCount()
+{
+    return detail::ClassManager::instance().indexCount();
+}
+
+inline const Class* classByIndex(size_t index)
+{
+    return detail::ClassManager::instance().getByIndex(index);
+}
+
+inline void freezeClasses()
+{
+    detail::ClassManager::instance().freezeClasses();
+}
+
 inline const Class& classByName(IdRef name)
 {
     // Note: detail::typeName() not used here so no automated registration.
@@ -48,19 +63,31 @@ inline const Class& classByName(IdRef name)
 template <typename T>
 const Class& classByObject(const T& object)
 {
-    return detail::ClassManager::instance().getById(detail::getTypeId(object));
+    // Without Ponder RTTI the dynamic type is the static type, so use the cache.
+    if constexpr (!detail::HasPonderRtti<T>::value)
+        return classByType<T>();
+    else
+        return detail::ClassManager::instance().getById(detail::getTypeId(object));
 }
 
 template <typename T>
 const Class& classByType()
 {
+    typedef typename detail::DataType<T>::Type Type;
+    if (const Class* cls = detail::ClassCache<Type>::slot.load(std::memory_order_acquire))
+        return *cls;
+
     return detail::ClassManager::instance().getById(detail::getTypeId<T>());
 }
 
 template <typename T>
 const Class* classByTypeSafe()
 {
-    return detail::ClassManager::instance().getByIdSafe(detail::calcTypeId<typename detail::DataType<T>::Type>());
+    typedef typename detail::DataType<T>::Type Type;
+    if (const Class* cls = detail::ClassCache<Type>::slot.load(std::memory_order_acquire))
+        return cls;
+
+    return detail::ClassManager::instance().getByIdSafe(detail::calcTypeId<Type>());
 }
 
 } // namespace ponder
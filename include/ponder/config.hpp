@@ -73,9 +73,25 @@
 #   define PONDER_USING_LUA 0
 #endif
 
+// Measure the reflected calls, see ponder::profiling
+#ifndef PONDER_PROFILING
+#   define PONDER_PROFILING 0
+#endif
+
+// Are exceptions enabled? Without them errors go to the error handler, see
+// ponder::setErrorHandler().
+#ifndef PONDER_EXCEPTIONS
+#   if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+#       define PONDER_EXCEPTIONS 1
+#   else
+#       define PONDER_EXCEPTIONS 0
+#   endif
+#endif
+
 // If user doesn't define traits use the default:
 #ifndef PONDER_ID_TRAITS_USER
 //# define PONDER_ID_TRAITS_STD_STRING      // Use std::string and const std::string&
+//# define PONDER_ID_TRAITS_INTERNED        // Use interned ids, compared by pointer
 #   define PONDER_ID_TRAITS_STRING_VIEW     // Use std::string and ponder::string_view
 #endif // PONDER_ID_TRAITS_USER
 
@@ -96,6 +96,11 @@ protected:
      */
     void removeElement(const UserObject& object, size_t index) const final;
 
+    /**
+     * \see Property::checkAccess
+     */
+    ErrorCode checkAccess(const UserObject& object, const Value* value) const final;
+
 private:
 
     typedef typename A::ExposedType ArrayType;
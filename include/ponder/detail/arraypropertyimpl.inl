@@ -84,6 +84,23 @@ void ArrayPropertyImpl<A>::removeElement(const UserObject& object, size_t index)
     Mapper::remove(array(object), index);
 }
 
+template <typename A>
+ErrorCode ArrayPropertyImpl<A>::checkAccess(const UserObject& object, const Value* value) const
+{
+    const ErrorCode error = object.checkGet<typename A::ClassType>();
+    if (error != ErrorCode::None)
+        return error;
+
+    // getValue() and setValue() access the first element
+    if (getSize(object) == 0)
+        return ErrorCode::OutOfRange;
+
+    if (value && !value->isCompatible<ElementType>())
+        return ErrorCode::BadType;
+
+    return ErrorCode::None;
+}
+
 template <typename A>
 typename ArrayPropertyImpl<A>::ArrayType& ArrayPropertyImpl<A>::array(const UserObject& object) const
 {
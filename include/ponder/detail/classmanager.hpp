@@ -33,14 +33,33 @@
 
 #include "observernotifier.hpp"
 #include <ponder/type.hpp>
-#include <map>
+#include <ponder/detail/hash.hpp>
+#include <ponder/detail/denseindex.hpp>
+#include <unordered_map>
+#include <atomic>
 
 namespace ponder {
     
 class Class;
 
 namespace detail {
-    
+
+// Slot caching the metaclass of a C++ type, see ClassCache.
+typedef std::atomic<const Class*> ClassCacheSlot;
+
+/*
+ * Per type cache of the metaclass, so that looking up a class by type is a single load.
+ *  - Filled on declaration and cleared when the metaclass is removed. Lookups only read
+ *    it, so they don't race with each other.
+ *  - Each module has its own slot for a type, the metaclass tracks those it filled. In
+ *    other modules lookups fall back to the class table.
+ */
+template <typename T>
+struct ClassCache
+{
+    static inline ClassCacheSlot slot{nullptr};
+};
+
 /**
  * \brief Manages creation, storage, retrieval and destruction of metaclasses
  *
@@ -52,8 +71,10 @@ namespace detail {
 class PONDER_API ClassManager : public ObserverNotifier
 {
     // No need for shared pointers in here, we're the one and only instance holder
-    typedef std::map<TypeId, Class*> ClassTable;
-    typedef std::map<Id, Class*> NameTable;
+    typedef std::unordered_map<TypeId, Class*> ClassTable;
+    // Keys view the name owned by the Class, so there is no copy and they stay valid
+    // for as long as the Class is registered.
+    typedef std::unordered_map<string_view, Class*, StringViewHash> NameTable;
 
 public:
 
@@ -98,6 +119,13 @@ public:
      * \return Number of metaclasses that have been registered
      */
     size_t count() const;
+
+    /**
+     * \brief Freeze all registered metaclasses
+     *
+     * \see Class::isFrozen
+     */
+    void freezeClasses();
     
     /**
      * \brief Get a metaclass from a C++ type
@@ -122,6 +150,22 @@ public:
      */
     const Class* getByIdSafe(TypeId const& id) const;
 
+    /**
+     * \brief Get a metaclass from its index
+     *
+     * \param index Index of the metaclass, see Class::index()
+     *
+     * \return Pointer to the requested metaclass, or null pointer if not found
+     */
+    const Class* getByIndex(size_t index) const;
+
+    /**
+     * \brief Get the upper bound of the metaclass indices
+     *
+     * \return All metaclass indices are less than this
+     */
+    size_t indexCount() const;
+
     /**
      * \brief Get a metaclass by name
      *
@@ -170,7 +214,13 @@ public:
 
 private:
 
+    void bindCache(Class& cls, ClassCacheSlot& slot); // Only when declaring
+    void clearCache(Class& cls);
+
+    friend class ponder::Class;
+
     ClassTable m_classes;   // Table storing classes indexed by their ID
+    DenseIndex<Class> m_indices; // Classes by index
     NameTable m_names;      // Name look up of classes
 };
 
@@ -0,0 +1,90 @@
+/****************************************************************************
+**
+** This file is part of the Ponder library, formerly CAMP.
+**
+** The MIT License (MIT)
+**
+** Copyright (C) 2009-2014 TEGESO/TEGESOFT and/or its subsidiary(-ies) and mother company.
+** Copyright (C) 2015-2020 Nick Trout.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a copy
+** of this software and associated documentation files (the "Software"), to deal
+** in the Software without restriction, including without limitation the rights
+** to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+** copies of the Software, and to permit persons to whom the Software is
+** furnished to do so, subject to the following conditions:
+** 
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+** 
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+** OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+** THE SOFTWARE.
+**
+****************************************************************************/
+
+#pragma once
+#ifndef PONDER_DETAIL_CONSTRUCTORCACHE_HPP
+#define PONDER_DETAIL_CONSTRUCTORCACHE_HPP
+
+#include <ponder/config.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace ponder {
+
+class Args;
+class Constructor;
+
+namespace detail {
+
+//
+// Constructor resolution of one metaclass.
+//  - Constructors are bucketed by arity, in declaration order, so only constructors with
+//    the right number of parameters are tried.
+//  - The result of the resolution is cached by signature of the arguments: the kind of
+//    each argument, and its metaclass or metaenum. A constructor only checks these, so
+//    it is matched once per distinct signature. Failed resolutions are cached too.
+//  - Resolutions are cached per thread, in a small direct mapped table shared by all
+//    metaclasses, so lookups take no lock. Colliding signatures replace each other.
+//  - Adding a constructor or clearing any cache invalidates all the cached resolutions.
+//  - Argument lists with more than c_maxCachedArgs arguments are resolved every time.
+//  - Lookups are thread safe. Declaring constructors is not.
+//
+class PONDER_API ConstructorCache
+{
+public:
+
+    static constexpr std::size_t c_maxCachedArgs = 6;
+
+    ConstructorCache() = default;
+    ConstructorCache(const ConstructorCache&) = delete;
+    ConstructorCache& operator = (const ConstructorCache&) = delete;
+    ~ConstructorCache();
+
+    // Add a constructor, tried after the ones with the same arity already added.
+    void add(const Constructor* constructor, std::size_t paramCount);
+
+    // Find the first constructor matching the arguments, or null.
+    const Constructor* find(const Args& args) const;
+
+    // Forget cached resolutions, e.g. when the metaclass of an argument is undeclared.
+    static void clear();
+
+private:
+
+    const Constructor* resolve(std::size_t arity, const Args& args) const;
+
+    typedef std::vector<const Constructor*> Bucket;
+
+    std::vector<Bucket> m_byArity;  // Constructors indexed by number of parameters
+};
+
+} // namespace detail
+} // namespace ponder
+
+#endif // PONDER_DETAIL_CONSTRUCTORCACHE_HPP
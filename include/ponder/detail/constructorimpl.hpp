@@ -59,6 +59,7 @@ namespace detail
 template <typename T>
 inline typename std::remove_reference<T>::type convertArg(const Args& args, size_t index)
 {
+#if PONDER_EXCEPTIONS
     try
     {
         return args[index].to<typename std::remove_reference<T>::type>();
@@ -67,6 +68,10 @@ inline typename std::remove_reference<T>::type convertArg(const Args& args, size
     {
         PONDER_ERROR(BadArgument(args[index].kind(), mapType<T>(), index, "constructor"));
     }
+#else
+    // The arguments were checked by Constructor::matches
+    return args[index].to<typename std::remove_reference<T>::type>();
+#endif
 }
 
 /**
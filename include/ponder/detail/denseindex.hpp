@@ -0,0 +1,88 @@
+/****************************************************************************
+**
+** This file is part of the Ponder library, formerly CAMP.
+**
+** The MIT License (MIT)
+**
+** Copyright (C) 2009-2014 TEGESO/TEGESOFT and/or its subsidiary(-ies) and mother company.
+** Copyright (C) 2015-2020 Nick Trout.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a copy
+** of this software and associated documentation files (the "Software"), to deal
+** in the Software without restriction, including without limitation the rights
+** to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+** copies of the Software, and to permit persons to whom the Software is
+** furnished to do so, subject to the following conditions:
+** 
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+** 
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+** OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+** THE SOFTWARE.
+**
+****************************************************************************/
+
+#pragma once
+#ifndef PONDER_DETAIL_DENSEINDEX_HPP
+#define PONDER_DETAIL_DENSEINDEX_HPP
+
+#include <vector>
+#include <cstddef>
+
+namespace ponder {
+namespace detail {
+
+/*
+ * Table of items indexed by small dense integers.
+ *  - Indices are allocated on add and freed on remove. Freed indices are reused so the
+ *    table stays as small as the largest number of items that have existed at once.
+ *  - Free slots hold nullptr.
+ */
+template <typename T>
+class DenseIndex
+{
+public:
+
+    std::size_t add(T* item)
+    {
+        if (m_free.empty())
+        {
+            m_items.push_back(item);
+            return m_items.size() - 1;
+        }
+
+        const std::size_t index = m_free.back();
+        m_free.pop_back();
+        m_items[index] = item;
+        return index;
+    }
+
+    void remove(std::size_t index)
+    {
+        m_items[index] = nullptr;
+        m_free.push_back(index);
+    }
+
+    T* get(std::size_t index) const
+    {
+        return index < m_items.size() ? m_items[index] : nullptr;
+    }
+
+    // Upper bound of the indices in use.
+    std::size_t size() const { return m_items.size(); }
+
+private:
+
+    std::vector<T*> m_items;
+    std::vector<std::size_t> m_free;
+};
+
+} // namespace detail
+} // namespace ponder
+
+#endif // PONDER_DETAIL_DENSEINDEX_HPP
@@ -32,9 +32,11 @@
 #define PONDER_DICTIONARY_HPP
 
 #include <ponder/config.hpp>
+#include <ponder/detail/hash.hpp>
 #include <utility>
 #include <vector>
 #include <algorithm> // std::lower_bound
+#include <cstdint>
 
 namespace ponder
 {
@@ -46,10 +48,130 @@ struct DictKeyCmp {
     bool operator () (T a, T b) const {return a < b;}
 };
 
+//
+// Minimal perfect hash over a fixed set of key hashes ("hash and displace").
+//  - Keys are grouped into buckets and each bucket is given a seed which displaces its
+//    keys into free slots. Every key maps to its own slot, so lookup is one probe.
+//  - Slots store the index of the key, the caller must confirm the key matches.
+//
+class PerfectHashIndex
+{
+public:
+
+    static constexpr std::uint32_t npos = ~std::uint32_t(0);
+
+    bool empty() const { return m_slots.empty(); }
+
+    void clear()
+    {
+        m_seeds.clear();
+        m_slots.clear();
+    }
+
+    // Build the index. Returns false if no perfect hash was found (index is left empty).
+    bool build(const std::vector<std::uint64_t>& hashes)
+    {
+        clear();
+        const std::size_t n = hashes.size();
+        if (n == 0)
+            return true;
+
+        const std::size_t nbuckets = (n + 1) / 2;
+        std::vector<std::vector<std::uint32_t>> buckets(nbuckets);
+        for (std::uint32_t i = 0; i < n; ++i)
+            buckets[reduce(mix(hashes[i], 0), nbuckets)].push_back(i);
+
+        // Place the largest buckets first, while there is the most freedom.
+        std::vector<std::uint32_t> order(nbuckets);
+        for (std::uint32_t i = 0; i < nbuckets; ++i)
+            order[i] = i;
+        std::stable_sort(order.begin(), order.end(), [&](std::uint32_t a, std::uint32_t b) {
+            return buckets[a].size() > buckets[b].size();
+        });
+
+        std::vector<std::uint32_t> seeds(nbuckets, 0);
+        std::vector<std::uint32_t> slots(n, npos);
+        std::vector<std::size_t> tried;
+        for (std::uint32_t b : order)
+        {
+            const auto& keys = buckets[b];
+            if (keys.empty())
+                break;
+
+            bool placed = false;
+            for (std::uint32_t seed = 1; seed < c_maxSeed && !placed; ++seed)
+            {
+                tried.clear();
+                placed = true;
+                for (std::uint32_t k : keys)
+                {
+                    const std::size_t slot = reduce(mix(hashes[k], seed), n);
+                    if (slots[slot] != npos
+                        || std::find(tried.begin(), tried.end(), slot) != tried.end())
+                    {
+                        placed = false;
+                        break;
+                    }
+                    tried.push_back(slot);
+                }
+                if (placed)
+                {
+                    seeds[b] = seed;
+                    for (std::size_t i = 0; i < keys.size(); ++i)
+                        slots[tried[i]] = keys[i];
+                }
+            }
+            if (!placed)
+                return false;
+        }
+
+        m_seeds.swap(seeds);
+        m_slots.swap(slots);
+        return true;
+    }
+
+    // Return the index of the only key which may have this hash, or npos.
+    std::uint32_t find(std::uint64_t hash) const
+    {
+        const std::uint32_t seed = m_seeds[reduce(mix(hash, 0), m_seeds.size())];
+        return seed == 0 ? npos : m_slots[reduce(mix(hash, seed), m_slots.size())];
+    }
+
+private:
+
+    static constexpr std::uint32_t c_maxSeed = 1u << 16;
+
+    // Map a hash to [0, n) with a multiply rather than a (slow) modulo.
+    static std::size_t reduce(std::uint64_t h, std::size_t n)
+    {
+        return static_cast<std::size_t>(((h >> 32) * static_cast<std::uint32_t>(n)) >> 32);
+    }
+
+    static std::uint64_t mix(std::uint64_t h, std::uint64_t seed)
+    {
+        // MurmurHash3 finaliser, salted with the seed.
+        h ^= seed * 0x9e3779b97f4a7c15ull;
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdull;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ull;
+        h ^= h >> 33;
+        return h;
+    }
+
+    std::vector<std::uint32_t> m_seeds;   // Displacement per bucket (0 if bucket empty)
+    std::vector<std::uint32_t> m_slots;   // Key index per slot
+};
+
 //
 // Key-value pair dictionary.
 //  - Stored as vector of pairs, more cache friendly.
 //  - Sorted on keys. Once only insertion cost gives better access times.
+//  - Optionally indexed by a perfect hash, see buildIndex(). Lookups are then one hash
+//    and one key compare. Modifying the dictionary drops the index.
+//  - Bulk inserts can be deferred, see insertDeferred(). They are sorted and merged once,
+//    by flush(), rather than shuffling the vector on every insert. Const accessors don't
+//    see them until then, and never write, so built dictionaries can be shared by threads.
 //
 template <typename KEY, typename KEY_REF, typename VALUE, class CMP = DictKeyCmp<KEY_REF>>
 class Dictionary
@@ -75,6 +197,10 @@ private:
 
     typedef std::vector<pair_t> container_t;
     container_t m_contents;
+    container_t m_pending;                // Deferred inserts, in insertion order
+
+    std::vector<std::uint64_t> m_hashes;  // Hash of each key, if indexed
+    PerfectHashIndex m_index;
 
 public:
 
@@ -86,6 +212,9 @@ public:
 
     const_iterator findKey(KEY_REF key) const
     {
+        if (!m_index.empty())
+            return findKey(key, hashKey(key));
+
         // binary search for key
         const_iterator it(std::lower_bound(m_contents.begin(), m_contents.end(), key, KeyCmp()));
         if (it != m_contents.end() && CMP()(key, it->first)) // it > it-1, check ==
@@ -93,6 +222,37 @@ public:
         return it;
     }
 
+    // Find using the key hash, which may have been precomputed.
+    const_iterator findKey(KEY_REF key, std::uint64_t hash) const
+    {
+        if (m_index.empty())
+            return findKey(key);
+
+        const std::uint32_t i = m_index.find(hash);
+        if (i != PerfectHashIndex::npos && m_hashes[i] == hash
+            && keysEqual(m_contents[i].first, key))
+        {
+            return m_contents.begin() + i;
+        }
+        return m_contents.end();
+    }
+
+    // Find a key given as a string, with a precomputed hash, without making a KEY. If the
+    // dictionary is not indexed it is searched with a KEY_REF, a view of the string.
+    const_iterator findHashed(string_view key, std::uint64_t hash) const
+    {
+        if (m_index.empty())
+            return findKey(KEY_REF(key));
+
+        const std::uint32_t i = m_index.find(hash);
+        if (i != PerfectHashIndex::npos && m_hashes[i] == hash
+            && keysEqual(m_contents[i].first, key))
+        {
+            return m_contents.begin() + i;
+        }
+        return m_contents.end();
+    }
+
     const_iterator findValue(const VALUE& value) const
     {
         for (auto&& it = m_contents.begin(); it != m_contents.end(); ++it)
@@ -126,8 +286,26 @@ public:
 
     size_t size() const { return m_contents.size(); }
 
+    // Build a perfect hash index of the current keys. Returns true if indexed.
+    bool buildIndex()
+    {
+        flush();
+        m_hashes.resize(m_contents.size());
+        for (size_t i = 0; i < m_contents.size(); ++i)
+            m_hashes[i] = hashKey(m_contents[i].first);
+
+        if (!m_index.build(m_hashes))
+            m_hashes.clear();
+
+        return !m_index.empty();
+    }
+
+    bool isIndexed() const { return !m_index.empty(); }
+
     void insert(KEY_REF key, const VALUE &value)
     {
+        dropIndex();
+        flush();
         erase(key);
         auto it = std::lower_bound(m_contents.begin(), m_contents.end(), key, KeyCmp());
         m_contents.insert(it, pair_t(key, value));
@@ -138,8 +316,25 @@ public:
         insert(it->first, it->second);
     }
 
+    // Insert without sorting now. A later insert of the same key replaces this one, and
+    // it replaces any existing entry when merged.
+    void insertDeferred(KEY_REF key, const VALUE &value)
+    {
+        dropIndex();
+        m_pending.push_back(pair_t(key, value));
+    }
+
+    // Sort and merge any deferred inserts.
+    void flush()
+    {
+        if (!m_pending.empty())
+            merge();
+    }
+
     void erase(KEY_REF key)
     {
+        dropIndex();
+        flush();
         const_iterator it = findKey(key);
         if (it != m_contents.end())
         {
@@ -153,6 +348,52 @@ public:
         std::advance(it, index);
         return it;
     }
+
+private:
+
+    static bool keysLess(const pair_t& a, const pair_t& b) { return CMP()(a.first, b.first); }
+
+    void merge()
+    {
+        // Sort the deferred inserts, keeping only the last insert of each key.
+        std::stable_sort(m_pending.begin(), m_pending.end(), keysLess);
+        auto last = m_pending.begin();
+        for (auto it = m_pending.begin(); it != m_pending.end(); ++it)
+        {
+            if (last != it && keysLess(*last, *it))
+                ++last;
+            if (last != it)
+                *last = *it;
+        }
+        m_pending.erase(last + 1, m_pending.end());
+
+        // Merge with the sorted contents. Deferred inserts replace existing keys.
+        container_t merged;
+        merged.reserve(m_contents.size() + m_pending.size());
+        auto a = m_contents.begin(), b = m_pending.begin();
+        while (a != m_contents.end() && b != m_pending.end())
+        {
+            if (keysLess(*a, *b))
+                merged.push_back(*a++);
+            else
+            {
+                if (!keysLess(*b, *a))
+                    ++a;
+                merged.push_back(*b++);
+            }
+        }
+        merged.insert(merged.end(), a, m_contents.end());
+        merged.insert(merged.end(), b, m_pending.end());
+
+        m_contents.swap(merged);
+        m_pending.clear();
+    }
+
+    void dropIndex()
+    {
+        m_index.clear();
+        m_hashes.clear();
+    }
 };
 
 } // detail
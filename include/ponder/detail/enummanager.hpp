@@ -33,8 +33,10 @@
 
 #include <ponder/detail/observernotifier.hpp>
 #include <ponder/detail/util.hpp>
+#include <ponder/detail/hash.hpp>
+#include <ponder/detail/denseindex.hpp>
 #include <string>
-#include <map>
+#include <unordered_map>
 
 namespace ponder
 {
@@ -113,6 +115,22 @@ public:
      */
     const Enum* getByIdSafe(TypeId const& id) const;
 
+    /**
+     * \brief Get a metaenum from its index
+     *
+     * \param index Index of the metaenum, see Enum::index()
+     *
+     * \return Pointer to the requested metaenum, or null pointer if not found
+     */
+    const Enum* getByIndex(size_t index) const;
+
+    /**
+     * \brief Get the upper bound of the metaenum indices
+     *
+     * \return All metaenum indices are less than this
+     */
+    size_t indexCount() const;
+
     /**
      * \brief Get a metaenum by name
      *
@@ -159,10 +177,11 @@ private:
      */
     ~EnumManager();
 
-    typedef std::map<TypeId, Enum*> EnumTable;
-    typedef std::map<Id, Enum*> NameTable;
+    typedef std::unordered_map<TypeId, Enum*> EnumTable;
+    typedef std::unordered_map<string_view, Enum*, StringViewHash> NameTable;
     EnumTable m_enums; // Table storing enums indexed by their TypeId
-    NameTable m_names; // Table storing enums indexed by their name
+    NameTable m_names; // Hashed index of enums by name (keys view the Enum's own name)
+    DenseIndex<Enum> m_indices; // Enums by index
 };
 
 } // namespace detail
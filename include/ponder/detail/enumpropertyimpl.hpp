@@ -81,6 +81,11 @@ protected:
      */
     void setValue(const UserObject& object, const Value& value) const final;
 
+    /**
+     * \see Property::checkAccess
+     */
+    ErrorCode checkAccess(const UserObject& object, const Value* value) const final;
+
 private:
 
     A m_accessor;
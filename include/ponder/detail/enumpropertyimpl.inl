@@ -51,6 +51,16 @@ void EnumPropertyImpl<A>::setValue(const UserObject& object, const Value& value)
         PONDER_ERROR(ForbiddenWrite(name()));
 }
 
+template <typename A>
+ErrorCode EnumPropertyImpl<A>::checkAccess(const UserObject& object, const Value* value) const
+{
+    const ErrorCode error = object.checkGet<typename A::ClassType>();
+    if (error != ErrorCode::None || !value)
+        return error;
+
+    return value->isCompatible<typename A::DataType>() ? ErrorCode::None : ErrorCode::BadType;
+}
+
 template <typename A>
 bool EnumPropertyImpl<A>::isReadable() const
 {
@@ -119,7 +119,6 @@ public:
 
     FunctionImpl(IdRef name, F function, P... policies) : Function(name)
     {
-        m_name = name;
         m_funcType = FuncTraits::kind;
         m_returnType = mapType<typename FuncTraits::ExposedType>();
         m_returnPolicy = ReturnPolicy<typename FuncTraits::ExposedType, P...> ::kind;
@@ -144,6 +143,7 @@ private:
         
         std::get<M>(m_userData) =
             Processor::template perFunction<F, T, FuncPolicies>(name, function);
+        std::get<M>(m_userData)->setProfile(&m_profile);
     }
     
     size_t paramCount() const override { return c_nParams; }
@@ -169,6 +169,29 @@ static inline Function* newFunction(IdRef name, F function, P... policies)
     return new FunctionImpl<FuncTraits, F, P...>(name, function, policies...);
 }
 
+// Function given as a template argument. Calls are direct so can be inlined.
+template <auto Fn>
+struct StaticFunction
+{
+    template <typename... A>
+    decltype(auto) operator () (A&&... args) const
+    {
+        return std::invoke(Fn, std::forward<A>(args)...);
+    }
+};
+
+// Used by ClassBuilder to create new function instance from a template argument.
+template <auto Fn, typename... P>
+static inline Function* newFunction(IdRef name, P... policies)
+{
+    typedef detail::FunctionTraits<decltype(Fn)> FuncTraits;
+
+    static_assert(FuncTraits::kind != FunctionKind::None, "Type is not a function");
+
+    return new FunctionImpl<FuncTraits, StaticFunction<Fn>, P...>(name, StaticFunction<Fn>(),
+                                                                  policies...);
+}
+
 } // namespace detail
 } // namespace ponder
 
@@ -0,0 +1,87 @@
+/****************************************************************************
+ **
+ ** This file is part of the Ponder library, formerly CAMP.
+ **
+ ** The MIT License (MIT)
+ **
+ ** Copyright (C) 2009-2014 TEGESO/TEGESOFT and/or its subsidiary(-ies) and mother company.
+ ** Copyright (C) 2015-2020 Nick Trout.
+ **
+ ** Permission is hereby granted, free of charge, to any person obtaining a copy
+ ** of this software and associated documentation files (the "Software"), to deal
+ ** in the Software without restriction, including without limitation the rights
+ ** to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ ** copies of the Software, and to permit persons to whom the Software is
+ ** furnished to do so, subject to the following conditions:
+ **
+ ** The above copyright notice and this permission notice shall be included in
+ ** all copies or substantial portions of the Software.
+ **
+ ** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ ** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ ** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ ** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ ** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ ** OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ ** THE SOFTWARE.
+ **
+ ****************************************************************************/
+
+#pragma once
+#ifndef PONDER_DETAIL_HASH_HPP
+#define PONDER_DETAIL_HASH_HPP
+
+#include <ponder/detail/string_view.hpp>
+#include <cstdint>
+
+namespace ponder {
+namespace detail {
+
+/*
+ * FNV-1a hash of a character sequence.
+ *  - constexpr so that identifiers known at compile time can be hashed by the compiler.
+ *  - Used for the name indexes so that all lookups agree on the hash.
+ */
+constexpr std::uint64_t hashString(const char* str, std::size_t len)
+{
+    std::uint64_t h = 14695981039346656037ull;
+    for (std::size_t i = 0; i < len; ++i)
+    {
+        h ^= static_cast<std::uint64_t>(static_cast<unsigned char>(str[i]));
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+inline std::uint64_t hashString(string_view str)
+{
+    return hashString(str.data(), str.size());
+}
+
+// Hash of a key of any string type. Identifier types may overload this.
+template <typename K>
+inline std::uint64_t hashKey(const K& key)
+{
+    return hashString(string_view(key));
+}
+
+// Compare keys of any string types. Identifier types may overload this.
+template <typename A, typename B>
+inline bool keysEqual(const A& a, const B& b)
+{
+    return string_view(a) == string_view(b);
+}
+
+// Hasher for unordered containers keyed on names.
+struct StringViewHash
+{
+    std::size_t operator () (string_view str) const
+    {
+        return static_cast<std::size_t>(hashString(str));
+    }
+};
+
+} // namespace detail
+} // namespace ponder
+
+#endif // PONDER_DETAIL_HASH_HPP
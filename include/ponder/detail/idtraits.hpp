@@ -78,7 +78,32 @@ struct IdTraits
 } // namespace detail
 } // namespace ponder
 
-#endif // PONDER_ID_TRAITS_STRING_VIEW
+#elif defined(PONDER_ID_TRAITS_INTERNED)
+
+#include <string>
+#include <ponder/detail/string_view.hpp>
+#include <ponder/detail/internedid.hpp>
+
+namespace ponder {
+
+    typedef std::size_t size_t;
+
+namespace detail {
+
+struct IdTraits
+{
+    typedef std::string         string_t;
+    typedef InternedId          id_value_t;
+    typedef InternedRef         id_ref_t;       // doesn't intern, so lookups don't grow the table
+    typedef InternedId          id_return_t;
+
+    static inline const char* cstr(id_ref_t r) {return r.c_str();}
+};
+
+} // namespace detail
+} // namespace ponder
+
+#endif // PONDER_ID_TRAITS_INTERNED
 
 namespace ponder {
 
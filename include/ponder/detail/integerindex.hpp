@@ -0,0 +1,128 @@
+/****************************************************************************
+**
+** This file is part of the Ponder library, formerly CAMP.
+**
+** The MIT License (MIT)
+**
+** Copyright (C) 2009-2014 TEGESO/TEGESOFT and/or its subsidiary(-ies) and mother company.
+** Copyright (C) 2015-2020 Nick Trout.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a copy
+** of this software and associated documentation files (the "Software"), to deal
+** in the Software without restriction, including without limitation the rights
+** to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+** copies of the Software, and to permit persons to whom the Software is
+** furnished to do so, subject to the following conditions:
+** 
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+** 
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+** OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+** THE SOFTWARE.
+**
+****************************************************************************/
+
+#pragma once
+#ifndef PONDER_DETAIL_INTEGERINDEX_HPP
+#define PONDER_DETAIL_INTEGERINDEX_HPP
+
+#include <ponder/config.hpp>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+
+namespace ponder {
+namespace detail {
+
+//
+// Index of a fixed set of integer keys, mapping each key to its position in the set.
+//  - Keys spanning a small range are looked up in a dense table, with one subtraction
+//    and one load.
+//  - Sparse keys fall back to a hash map.
+//
+template <typename T>
+class IntegerIndex
+{
+public:
+
+    static constexpr std::uint32_t npos = ~std::uint32_t(0);
+
+    IntegerIndex() : m_min(0), m_built(false) {}
+
+    bool empty() const { return !m_built; }
+
+    void clear()
+    {
+        m_dense.clear();
+        m_sparse.clear();
+        m_built = false;
+    }
+
+    // Index the keys. Keys must be unique, key i is found at position i.
+    void build(const std::vector<T>& keys)
+    {
+        clear();
+        m_built = true;
+        if (keys.empty())
+            return;
+
+        const auto mm = std::minmax_element(keys.begin(), keys.end());
+        m_min = *mm.first;
+
+        // Compare unsigned so that huge ranges don't overflow.
+        typedef typename std::make_unsigned<T>::type range_t;
+        const range_t range = static_cast<range_t>(*mm.second) - static_cast<range_t>(m_min);
+        if (range < c_denseMin + 2 * static_cast<range_t>(keys.size()))
+        {
+            m_dense.assign(static_cast<std::size_t>(range) + 1, npos);
+            for (std::uint32_t i = 0; i < keys.size(); ++i)
+                m_dense[offset(keys[i])] = i;
+        }
+        else
+        {
+            m_sparse.reserve(keys.size());
+            for (std::uint32_t i = 0; i < keys.size(); ++i)
+                m_sparse.emplace(keys[i], i);
+        }
+    }
+
+    // Return the position of the key, or npos if not found.
+    std::uint32_t find(T key) const
+    {
+        if (!m_dense.empty())
+        {
+            const std::size_t i = offset(key);
+            return i < m_dense.size() ? m_dense[i] : npos;
+        }
+        const auto it = m_sparse.find(key);
+        return it == m_sparse.end() ? npos : it->second;
+    }
+
+private:
+
+    // Keys spanning fewer than this (plus twice the key count) use a dense table.
+    static constexpr std::size_t c_denseMin = 64;
+
+    std::size_t offset(T key) const
+    {
+        typedef typename std::make_unsigned<T>::type range_t;
+        return static_cast<std::size_t>(static_cast<range_t>(key) - static_cast<range_t>(m_min));
+    }
+
+    T m_min;                                        // Smallest key, dense table origin
+    std::vector<std::uint32_t> m_dense;             // Position per key offset, if dense
+    std::unordered_map<T, std::uint32_t> m_sparse;  // Position per key, if sparse
+    bool m_built;
+};
+
+} // namespace detail
+} // namespace ponder
+
+#endif // PONDER_DETAIL_INTEGERINDEX_HPP
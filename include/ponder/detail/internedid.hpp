@@ -0,0 +1,234 @@
+/****************************************************************************
+**
+** This file is part of the Ponder library, formerly CAMP.
+**
+** The MIT License (MIT)
+**
+** Copyright (C) 2009-2014 TEGESO/TEGESOFT and/or its subsidiary(-ies) and mother company.
+** Copyright (C) 2015-2020 Nick Trout.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a copy
+** of this software and associated documentation files (the "Software"), to deal
+** in the Software without restriction, including without limitation the rights
+** to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+** copies of the Software, and to permit persons to whom the Software is
+** furnished to do so, subject to the following conditions:
+** 
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+** 
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+** OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+** THE SOFTWARE.
+**
+****************************************************************************/
+
+// config.hpp is included before the guard. With PONDER_ID_TRAITS_INTERNED, config.hpp
+// includes idtraits.hpp, which includes this and needs InternedId, so when this header is
+// included first, the class must be defined by that nested include.
+#include <ponder/config.hpp>
+
+#ifndef PONDER_DETAIL_INTERNEDID_HPP
+#define PONDER_DETAIL_INTERNEDID_HPP
+
+#include <ponder/detail/string_view.hpp>
+#include <ponder/detail/hash.hpp>
+#include <string>
+#include <ostream>
+
+namespace ponder {
+namespace detail {
+
+/*
+ * Interned identifier.
+ *  - Names are stored once, in a global thread-safe symbol table, and never released.
+ *  - An InternedId is a pointer to its symbol, so copies are cheap and equal names have
+ *    equal pointers. Equality and hashing are O(1).
+ *  - Ordering is by the string, so sorted containers keep the same order as with strings.
+ *  - Constructing from a string interns it, which takes a lock. Keep ids where possible.
+ *  - Lookups take an InternedRef, which doesn't intern, so unknown names don't grow the
+ *    symbol table.
+ */
+class InternedRef;
+
+class PONDER_API InternedId
+{
+public:
+
+    struct Symbol
+    {
+        std::string str;
+        std::uint64_t hash;
+    };
+
+    constexpr InternedId() : m_sym(nullptr) {}
+    InternedId(const char* str) : m_sym(intern(string_view(str))) {}
+    InternedId(const char* str, std::size_t len) : m_sym(intern(string_view(str, len))) {}
+    InternedId(const std::string& str) : m_sym(intern(string_view(str))) {}
+    InternedId(string_view str) : m_sym(intern(str)) {}
+    explicit InternedId(const InternedRef& ref);
+
+    const std::string& str() const { return m_sym ? m_sym->str : emptyString(); }
+    const char* c_str() const { return str().c_str(); }
+    const char* data() const { return str().data(); }
+    std::size_t size() const { return m_sym ? m_sym->str.size() : 0; }
+    std::size_t length() const { return size(); }
+    bool empty() const { return m_sym == nullptr; }
+
+    // Hash of the name, the same as detail::hashString() of the string.
+    std::uint64_t hash() const { return m_sym ? m_sym->hash : hashString(nullptr, 0); }
+
+    int compare(const InternedId& other) const
+    {
+        return m_sym == other.m_sym ? 0 : str().compare(other.str());
+    }
+
+    operator const std::string& () const { return str(); }
+    operator string_view () const { return string_view(data(), size()); }
+
+    friend bool operator == (InternedId a, InternedId b) { return a.m_sym == b.m_sym; }
+    friend bool operator != (InternedId a, InternedId b) { return a.m_sym != b.m_sym; }
+    friend bool operator < (InternedId a, InternedId b) { return a.compare(b) < 0; }
+    friend bool operator > (InternedId a, InternedId b) { return a.compare(b) > 0; }
+    friend bool operator <= (InternedId a, InternedId b) { return a.compare(b) <= 0; }
+    friend bool operator >= (InternedId a, InternedId b) { return a.compare(b) >= 0; }
+
+    /*
+     * Find an existing id without interning the name.
+     *  - Returns an empty id if the name has never been interned. Useful for lookups
+     *    which should not grow the symbol table.
+     */
+    static InternedId find(string_view str);
+
+    // Number of names interned.
+    static std::size_t symbolCount();
+
+private:
+
+    friend class InternedRef;
+
+    explicit InternedId(const Symbol* sym) : m_sym(sym) {}
+
+    static const Symbol* intern(string_view str);
+    static const std::string& emptyString();
+
+    const Symbol* m_sym;
+};
+
+static inline std::ostream& operator << (std::ostream& os, const InternedId& id)
+{
+    return os << id.str();
+}
+
+/*
+ * Reference to an identifier, used to pass names to lookups.
+ *  - Made from an InternedId, it keeps the symbol: equality and hashing are O(1).
+ *  - Made from a string, it views the string and doesn't intern it, or even take the
+ *    symbol table lock. It compares by contents, so a name which was never interned is
+ *    simply not found. Like a string_view it must not outlive the string.
+ *  - Storing it as an InternedId interns the name.
+ */
+class InternedRef
+{
+public:
+
+    constexpr InternedRef() : m_sym(nullptr) {}
+    InternedRef(const InternedId& id) : m_sym(id.m_sym), m_str(id) {}
+    InternedRef(const char* str) : m_sym(nullptr), m_str(str) {}
+    InternedRef(const char* str, std::size_t len) : m_sym(nullptr), m_str(str, len) {}
+    InternedRef(const std::string& str) : m_sym(nullptr), m_str(str) {}
+    InternedRef(string_view str) : m_sym(nullptr), m_str(str) {}
+
+    const char* data() const { return m_str.data(); }
+    std::size_t size() const { return m_str.size(); }
+    std::size_t length() const { return m_str.size(); }
+    bool empty() const { return m_str.empty(); }
+
+    // Null-terminated name. Only valid if the string viewed was null-terminated.
+    const char* c_str() const { return m_sym ? m_sym->str.c_str() : m_str.data(); }
+
+    // Hash of the name, the same as InternedId::hash().
+    std::uint64_t hash() const { return m_sym ? m_sym->hash : hashString(m_str); }
+
+    // The id of the name if it has been interned, else an empty id. Doesn't intern.
+    InternedId find() const { return m_sym ? InternedId(m_sym) : InternedId::find(m_str); }
+
+    int compare(const InternedRef& other) const
+    {
+        return m_sym && m_sym == other.m_sym ? 0 : m_str.compare(other.m_str);
+    }
+
+    operator string_view () const { return m_str; }
+
+    friend bool operator == (const InternedRef& a, const InternedRef& b)
+    {
+        if (a.m_sym && b.m_sym)
+            return a.m_sym == b.m_sym;
+        return a.m_str == b.m_str;
+    }
+    friend bool operator != (const InternedRef& a, const InternedRef& b) { return !(a == b); }
+    friend bool operator < (const InternedRef& a, const InternedRef& b) { return a.compare(b) < 0; }
+    friend bool operator > (const InternedRef& a, const InternedRef& b) { return a.compare(b) > 0; }
+    friend bool operator <= (const InternedRef& a, const InternedRef& b) { return a.compare(b) <= 0; }
+    friend bool operator >= (const InternedRef& a, const InternedRef& b) { return a.compare(b) >= 0; }
+
+private:
+
+    friend class InternedId;
+
+    const InternedId::Symbol* m_sym; // Symbol, if made from an id
+    string_view m_str;
+};
+
+inline InternedId::InternedId(const InternedRef& ref)
+    : m_sym(ref.m_sym ? ref.m_sym : intern(ref.m_str))
+{
+}
+
+static inline std::ostream& operator << (std::ostream& os, const InternedRef& ref)
+{
+    return os << string_view(ref);
+}
+
+// Overloads of the generic key helpers in hash.hpp.
+inline std::uint64_t hashKey(const InternedId& id)
+{
+    return id.hash();
+}
+
+inline bool keysEqual(const InternedId& a, const InternedId& b)
+{
+    return a == b;
+}
+
+inline std::uint64_t hashKey(const InternedRef& ref)
+{
+    return ref.hash();
+}
+
+inline bool keysEqual(const InternedId& a, const InternedRef& b)
+{
+    return InternedRef(a) == b;
+}
+
+} // namespace detail
+} // namespace ponder
+
+namespace std {
+
+template <>
+struct hash<ponder::detail::InternedId>
+{
+    size_t operator () (const ponder::detail::InternedId& id) const
+    {
+        return static_cast<size_t>(id.hash());
+    }
+};
+
+} // namespace std
+
+#endif // PONDER_DETAIL_INTERNEDID_HPP
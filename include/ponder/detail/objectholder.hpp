@@ -33,6 +33,7 @@
 
 #include <ponder/classget.hpp>
 #include <ponder/classcast.hpp>
+#include <memory_resource>
 
 namespace ponder {
 namespace detail {
@@ -41,7 +42,6 @@ namespace detail {
  * \brief Abstract base class for object holders
  *
  * This class is meant to be used by UserObject.
- * @todo Use an optimized memory pool if there are too many allocations of holders
  */
 class AbstractObjectHolder
 {
@@ -69,6 +69,16 @@ public:
      */
     virtual AbstractObjectHolder* getWritable() = 0;
 
+    /**
+     * \brief Return a new holder storing a copy of the object
+     *
+     * \param resource Memory resource to allocate the new holder from
+     *
+     * \return Holder storing a copy, or null if the object is not copyable
+     */
+    virtual std::shared_ptr<AbstractObjectHolder>
+        clone(std::pmr::memory_resource* resource) const = 0;
+
 protected:
 
     AbstractObjectHolder();
@@ -106,6 +116,15 @@ public:
      */
     AbstractObjectHolder* getWritable() final;
 
+    /**
+     * \brief Return a new holder storing a copy of the object
+     *
+     * \param resource Memory resource to allocate the new holder from
+     *
+     * \return Holder storing a copy, or null if the object is not copyable
+     */
+    std::shared_ptr<AbstractObjectHolder> clone(std::pmr::memory_resource* resource) const final;
+
 private:
 
     const T* m_object; // Pointer to the object
@@ -146,6 +165,15 @@ public:
      */
     AbstractObjectHolder* getWritable() final;
 
+    /**
+     * \brief Return a new holder storing a copy of the object
+     *
+     * \param resource Memory resource to allocate the new holder from
+     *
+     * \return Holder storing a copy, or null if the object is not copyable
+     */
+    std::shared_ptr<AbstractObjectHolder> clone(std::pmr::memory_resource* resource) const final;
+
 private:
 
     T* m_object; // Pointer to the object
@@ -188,6 +216,15 @@ public:
      */
     AbstractObjectHolder* getWritable() final;
 
+    /**
+     * \brief Return a new holder storing a copy of the object
+     *
+     * \param resource Memory resource to allocate the new holder from
+     *
+     * \return Holder storing a copy, or null if the object is not copyable
+     */
+    std::shared_ptr<AbstractObjectHolder> clone(std::pmr::memory_resource* resource) const final;
+
 private:
 
     T m_object; // Copy of the object
@@ -39,6 +39,20 @@ inline AbstractObjectHolder::AbstractObjectHolder()
 {
 }
 
+// Copy an object into a new holder, allocated from a memory resource.
+template <typename T>
+std::shared_ptr<AbstractObjectHolder> cloneObject(const T& object,
+                                                  std::pmr::memory_resource* resource)
+{
+    if constexpr (std::is_copy_constructible<T>::value)
+    {
+        std::pmr::polymorphic_allocator<ObjectHolderByCopy<T>> allocator(resource);
+        return std::allocate_shared<ObjectHolderByCopy<T>>(allocator, &object);
+    }
+    else
+        return nullptr;
+}
+
 template <typename T>
 ObjectHolderByConstRef<T>::ObjectHolderByConstRef(const T* object)
     : m_object(object)
@@ -60,6 +74,13 @@ AbstractObjectHolder* ObjectHolderByConstRef<T>::getWritable()
     return nullptr; //new ObjectHolderByCopy<T>(m_object); XXXX const ref?!
 }
 
+template <typename T>
+std::shared_ptr<AbstractObjectHolder>
+    ObjectHolderByConstRef<T>::clone(std::pmr::memory_resource* resource) const
+{
+    return cloneObject(*m_object, resource);
+}
+
 template <typename T>
 ObjectHolderByRef<T>::ObjectHolderByRef(T* object)
     : m_object(object)
@@ -80,6 +101,13 @@ AbstractObjectHolder* ObjectHolderByRef<T>::getWritable()
     return this;
 }
 
+template <typename T>
+std::shared_ptr<AbstractObjectHolder>
+    ObjectHolderByRef<T>::clone(std::pmr::memory_resource* resource) const
+{
+    return cloneObject(*m_object, resource);
+}
+
 template <typename T>
 ObjectHolderByCopy<T>::ObjectHolderByCopy(const T* object)
     : m_object(*object)
@@ -105,5 +133,12 @@ AbstractObjectHolder* ObjectHolderByCopy<T>::getWritable()
     return this;
 }
 
+template <typename T>
+std::shared_ptr<AbstractObjectHolder>
+    ObjectHolderByCopy<T>::clone(std::pmr::memory_resource* resource) const
+{
+    return cloneObject(m_object, resource);
+}
+
 } // namespace detail
 } // namespace ponder
@@ -0,0 +1,91 @@
+/****************************************************************************
+**
+** This file is part of the Ponder library, formerly CAMP.
+**
+** The MIT License (MIT)
+**
+** Copyright (C) 2009-2014 TEGESO/TEGESOFT and/or its subsidiary(-ies) and mother company.
+** Copyright (C) 2015-2020 Nick Trout.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a copy
+** of this software and associated documentation files (the "Software"), to deal
+** in the Software without restriction, including without limitation the rights
+** to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+** copies of the Software, and to permit persons to whom the Software is
+** furnished to do so, subject to the following conditions:
+** 
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+** 
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+** OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+** THE SOFTWARE.
+**
+****************************************************************************/
+
+#pragma once
+#ifndef PONDER_DETAIL_OBJECTPOOL_HPP
+#define PONDER_DETAIL_OBJECTPOOL_HPP
+
+#include <ponder/config.hpp>
+#include <memory_resource>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace ponder {
+namespace detail {
+
+//
+// Pool of fixed size blocks, for the objects owned by user objects of one metaclass.
+//  - Blocks are sized from the class size, larger requests go to the upstream resource
+//    but still count as in use.
+//  - Freed blocks are kept on a free list, memory is only returned when the pool is
+//    destroyed.
+//  - The metaclass releases the pool when it is destroyed. The pool is deleted once the
+//    last block is freed, so objects may outlive their metaclass.
+//
+class PONDER_API ObjectPool final : public std::pmr::memory_resource
+{
+public:
+
+    ObjectPool(std::size_t objectSize, std::pmr::memory_resource* upstream);
+
+    // Release the owner's reference. Deletes the pool if no blocks are in use.
+    void release();
+
+    std::size_t blockSize() const { return m_blockSize; }
+
+private:
+
+    ~ObjectPool();
+
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+    void grow();
+
+    struct Block
+    {
+        Block* next;
+    };
+
+    std::pmr::memory_resource* m_upstream;
+    const std::size_t m_blockSize;
+    std::size_t m_chunkBlocks;          // Number of blocks in the next chunk
+    std::vector<std::pair<void*, std::size_t>> m_chunks; // Chunks from upstream, and sizes
+    Block* m_free;                      // Free list
+    std::size_t m_used;                 // Number of blocks in use, including upstream ones
+    bool m_released;                    // Owner has released the pool
+    std::mutex m_mutex;
+};
+
+} // namespace detail
+} // namespace ponder
+
+#endif // PONDER_DETAIL_OBJECTPOOL_HPP
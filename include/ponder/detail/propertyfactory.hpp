@@ -109,6 +109,7 @@ class InternalRefBinder
 public:        
     typedef C ClassType;
     typedef typename PropTraits::ExposedType AccessType;
+    typedef AccessType SetType;
 
     using Binding = typename PropTraits::template Binding<ClassType, AccessType>;
 
@@ -152,6 +153,22 @@ protected:
     std::function<void(typename Base::ClassType&, typename Base::AccessType)> m_set;
 };
 
+// Setter known at compile time, replacing the std::function of the "2" binders.
+template <class B, auto Setter>
+class StaticSetterBinder : public B
+{
+public:
+    StaticSetterBinder(const typename B::Binding& g) : B(g) {}
+
+    bool setter(typename B::ClassType& c, typename B::SetType v) const {
+        return std::invoke(Setter, c, v), true;
+    }
+
+    bool setter(typename B::ClassType& c, Value const& value) const {
+        return setter(c, value.to<typename B::SetType>());
+    }
+};
+
 /*
  *  Access traits for an exposed type T.
  *    - I.e. how we use an instance to access the bound property data using the correct interface.
@@ -308,6 +325,56 @@ public:
     {}
 };
 
+/*
+ * Property accessor composed of 1 getter and 1 setter, both known at compile time.
+ */
+template <typename C, typename FUNCTRAITS, auto Setter>
+class StaticGetSet2
+{
+public:
+
+    typedef FUNCTRAITS PropTraits;
+    typedef C ClassType;
+    typedef typename PropTraits::ExposedType ExposedType;
+    typedef typename PropTraits::ExposedTraits TypeTraits;
+    typedef typename PropTraits::DataType DataType; // raw type
+    static constexpr bool canRead = true;
+    static constexpr bool canWrite = true;
+
+    typedef AccessTraits<PropTraits> Access;
+
+    typedef StaticSetterBinder<typename Access::template ValueBinder<ClassType>, Setter> InterfaceType;
+
+    InterfaceType m_interface;
+
+    StaticGetSet2(typename PropTraits::BoundType getter)
+        : m_interface(typename InterfaceType::Binding(getter))
+    {}
+};
+
+/*
+ * Traits of an accessor given as a template argument.
+ *  - The binding calls the accessor directly instead of through a stored pointer, so
+ *    the compiler can inline the access.
+ */
+template <auto Accessor>
+struct StaticAccessorTraits
+    : std::conditional<std::is_member_object_pointer<decltype(Accessor)>::value,
+                       MemberTraits<decltype(Accessor)>, FunctionTraits<decltype(Accessor)>>::type
+{
+    template <typename C, typename A>
+    class Binding
+    {
+    public:
+        typedef C ClassType;
+        typedef A AccessType;
+
+        Binding(decltype(Accessor)) {}
+
+        AccessType access(ClassType& c) const {return std::invoke(Accessor, c);}
+    };
+};
+
 /*
  * Property factory which instantiates the proper type of property from 1 accessor.
  */
@@ -358,6 +425,26 @@ struct PropertyFactory2
     }
 };
 
+/*
+ * Property factory for accessors given as template arguments.
+ *  - Accessor - getter, or member object accessed directly.
+ *  - Setter - optional setter, or nullptr.
+ */
+template <typename C, auto Accessor, auto Setter = nullptr>
+struct StaticPropertyFactory
+{
+    static Property* create(IdRef name)
+    {
+        typedef StaticAccessorTraits<Accessor> PropTraits;
+        typedef typename std::conditional<std::is_null_pointer<decltype(Setter)>::value,
+            GetSet1<C, PropTraits>, StaticGetSet2<C, PropTraits, Setter>>::type Accessors;
+
+        typedef typename Accessors::Access::template Impl<Accessors> PropertyImpl;
+
+        return new PropertyImpl(name, Accessors(Accessor));
+    }
+};
+
 } // namespace detail
 } // namespace ponder
 
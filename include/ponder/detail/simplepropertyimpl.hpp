@@ -81,8 +81,23 @@ protected:
      */
     void setValue(const UserObject& object, const Value& value) const final;
 
+    /**
+     * \see Property::typedAccess
+     */
+    const void* typedAccess(TypeId type) const final;
+
+    /**
+     * \see Property::checkAccess
+     */
+    ErrorCode checkAccess(const UserObject& object, const Value* value) const final;
+
 private:
 
+    typedef typename A::DataType DataType;
+
+    static DataType getTyped(const Property& property, const UserObject& object);
+    static void setTyped(const Property& property, const UserObject& object, const DataType& value);
+
     A m_accessor; // Accessor used to access the actual C++ property
 };
 
@@ -51,6 +51,45 @@ void SimplePropertyImpl<A>::setValue(const UserObject& object, const Value& valu
         PONDER_ERROR(ForbiddenWrite(name()));
 }
 
+template <typename A>
+const void* SimplePropertyImpl<A>::typedAccess(TypeId type) const
+{
+    static constexpr TypedPropertyAccess<DataType> access {
+        &getTyped, A::canWrite ? &setTyped : nullptr
+    };
+
+    return type == calcTypeId<DataType>() ? &access : nullptr;
+}
+
+template <typename A>
+ErrorCode SimplePropertyImpl<A>::checkAccess(const UserObject& object, const Value* value) const
+{
+    const ErrorCode error = object.checkGet<typename A::ClassType>();
+    if (error != ErrorCode::None || !value)
+        return error;
+
+    return value->isCompatible<typename A::DataType>() ? ErrorCode::None : ErrorCode::BadType;
+}
+
+template <typename A>
+typename A::DataType SimplePropertyImpl<A>::getTyped(const Property& property,
+                                                     const UserObject& object)
+{
+    const auto& self = static_cast<const SimplePropertyImpl<A>&>(property);
+    return self.m_accessor.m_interface.getter(object.get<typename A::ClassType>());
+}
+
+template <typename A>
+void SimplePropertyImpl<A>::setTyped(const Property& property, const UserObject& object,
+                                     const DataType& value)
+{
+    if (!object.pointer())
+        PONDER_ERROR(NullObject(&object.getClass()));
+
+    const auto& self = static_cast<const SimplePropertyImpl<A>&>(property);
+    self.m_accessor.m_interface.setter(object.ref<typename A::ClassType>(), value);
+}
+
 template <typename A>
 bool SimplePropertyImpl<A>::isReadable() const
 {
@@ -51,6 +51,11 @@ protected:
     Value getValue(const UserObject& object) const final;
     void setValue(const UserObject& object, const Value& value) const final;
 
+    /**
+     * \see Property::checkAccess
+     */
+    ErrorCode checkAccess(const UserObject& object, const Value* value) const final;
+
 private:
 
     A m_accessor; // Object used to access the actual C++ property
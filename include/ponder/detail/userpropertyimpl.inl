@@ -50,6 +50,16 @@ void UserPropertyImpl<A>::setValue(const UserObject& object, const Value& value)
         PONDER_ERROR(ForbiddenWrite(name()));
 }
 
+template <typename A>
+ErrorCode UserPropertyImpl<A>::checkAccess(const UserObject& object, const Value* value) const
+{
+    const ErrorCode error = object.checkGet<typename A::ClassType>();
+    if (error != ErrorCode::None || !value)
+        return error;
+
+    return value->isCompatible<typename A::DataType>() ? ErrorCode::None : ErrorCode::BadType;
+}
+
 template <typename A>
 bool UserPropertyImpl<A>::isReadable() const
 {
@@ -33,6 +33,7 @@
 
 #include <ponder/config.hpp>
 #include <ponder/type.hpp>
+#include <cstdlib>
 #include <type_traits>
 #include <memory>
 
@@ -68,26 +69,26 @@ struct convert_impl
 };
 
 template <typename F>
-Id to_str(F from)
+String to_str(F from)
 {
     return std::to_string(from);
 }
     
 template <typename F>
-struct convert_impl <Id, F>
+struct convert_impl <String, F>
 {
-    Id operator () (const F& from)
+    String operator () (const F& from)
     {
         return detail::to_str(from);
     }
 };
 
 template <>
-struct convert_impl <Id, bool>
+struct convert_impl <String, bool>
 {
-    Id operator () (const bool& from)
+    String operator () (const bool& from)
     {
-        static const Id t("1"), f("0");
+        static const String t("1"), f("0");
         return from ? t : f;
     }
 };
@@ -107,7 +108,7 @@ PONDER_API bool conv(const String& from, float& to);
 PONDER_API bool conv(const String& from, double& to);
 
 template <typename T>
-struct convert_impl <T, Id,
+struct convert_impl <T, String,
     typename std::enable_if< (std::is_integral<T>::value || std::is_floating_point<T>::value)
                              && !std::is_const<T>::value
                              && !std::is_reference<T>::value >::type >
@@ -116,7 +117,13 @@ struct convert_impl <T, Id,
     {
         T result;
         if (!conv(from, result))
+        {
+#if PONDER_EXCEPTIONS
             throw detail::bad_conversion();
+#else
+            std::abort(); // Value::to() checks the conversion first
+#endif
+        }
         return result;
     }
 };
@@ -127,6 +134,14 @@ T convert(const F& from)
     return convert_impl<T,F>()(from);
 }
 
+// Check if convert<T>(from) would succeed.
+template <typename T>
+bool canConvert(const String& from)
+{
+    T result;
+    return conv(from, result);
+}
+
 //------------------------------------------------------------------------------
 // index_sequence
 // From: http://stackoverflow.com/a/32223343/3233
@@ -33,6 +33,9 @@
 
 #include <ponder/type.hpp>
 #include <ponder/valuemapper.hpp>
+#include <exception>
+#include <type_traits>
+#include <utility>
 
 namespace ponder {
 namespace detail {
@@ -69,6 +72,68 @@ struct ConvertVisitor
     }
 };
 
+/*
+ * Check if ValueMapper<T>::from(source) succeeds, without throwing. Mappers declare
+ * isConvertible() for the conversions which can fail. Otherwise the conversion is made and
+ * its error caught, or, without exceptions, it is assumed to succeed.
+ */
+template <typename T, typename U, typename E = void>
+struct MapperCheck
+{
+    static bool isConvertible(const U& source)
+    {
+#if PONDER_EXCEPTIONS
+        try
+        {
+            ponder_ext::ValueMapper<T>::from(source);
+            return true;
+        }
+        catch (std::exception&)
+        {
+            return false;
+        }
+#else
+        (void) source;
+        return true;
+#endif
+    }
+};
+
+template <typename T, typename U>
+struct MapperCheck<T, U, std::void_t<decltype(
+    ponder_ext::ValueMapper<T>::isConvertible(std::declval<const U&>()))>>
+{
+    static bool isConvertible(const U& source)
+    {
+        return ponder_ext::ValueMapper<T>::isConvertible(source);
+    }
+};
+
+/**
+ * \brief Value visitor which checks if the stored value can be converted to a type T
+ */
+template <typename T>
+struct CompatibleVisitor
+{
+    typedef bool result_type;
+
+    template <typename U>
+    bool operator()(const U& value) const
+    {
+        return MapperCheck<T, U>::isConvertible(value);
+    }
+
+    bool operator()(const T&) const
+    {
+        return true;
+    }
+
+    bool operator()(NoType) const
+    {
+        return false;
+    }
+};
+
 /**
  * \brief Binary value visitor which compares two values using operator <
  */
@@ -37,6 +37,7 @@
 #include <ponder/pondertype.hpp>
 #include <ponder/detail/typeid.hpp>
 #include <ponder/detail/dictionary.hpp>
+#include <ponder/detail/integerindex.hpp>
 #include <string>
 
 namespace ponder {
@@ -143,6 +144,19 @@ public:
      * \return String containing the name of the metaenum
      */
     IdReturn name() const;
+
+    /**
+     * \brief Return the index of the metaenum
+     *
+     * Each registered metaenum has a small unique index, less than ponder::enumIndexCount().
+     *
+     * \note The index of an undeclared metaenum may be reused by a new metaenum.
+     *
+     * \return Index of the metaenum
+     *
+     * \see ponder::enumByIndex
+     */
+    size_t index() const;
         
     /**
      * \brief Return the size of the metaenum
@@ -275,11 +289,30 @@ private:
      * \param name Name of the metaenum
      */
     Enum(IdRef name);
-    
+
+    /**
+     * \brief Add a <name, value> pair, dropping the lookup indices
+     */
+    void addValue(IdRef name, EnumValue value);
+
+    /**
+     * \brief Index names and values so that lookups don't search the table
+     *
+     * This is called when the EnumBuilder completes. Lookups still work before this,
+     * they are just slower.
+     */
+    void buildIndex();
+
+    // Position of the pair with this value, or npos if not found
+    std::uint32_t findValue(EnumValue value) const;
+
     typedef detail::Dictionary<Id, IdRef, EnumValue> EnumTable;
+    typedef detail::IntegerIndex<EnumValue> ValueIndex;
     
     Id m_name;              // Name of the metaenum
+    size_t m_index;         // Dense index of the metaenum
     EnumTable m_enums;      // Table of enums
+    ValueIndex m_values;    // Index of the enum values
 };
 
 } // namespace ponder
@@ -59,6 +59,11 @@ public:
      */
     explicit EnumBuilder(Enum& target);
 
+    /**
+     * \brief Destructor, indexes the completed metaenum
+     */
+    ~EnumBuilder();
+
     /**
      * \brief Add a new pair to the metaenum
      *
@@ -47,6 +47,26 @@ namespace ponder {
  */
 size_t enumCount();
 
+/**
+ * \relates Enum
+ *
+ * \brief Get the upper bound of metaenum indices
+ *
+ * \return All metaenum indices are less than this
+ */
+size_t enumIndexCount();
+
+/**
+ * \relates Enum
+ *
+ * \brief Get a metaenum from its index
+ *
+ * \param index Index of the metaenum, see Enum::index()
+ *
+ * \return Pointer to the metaenum, or nullptr if no metaenum has this index
+ */
+const Enum* enumByIndex(size_t index);
+
 /**
  * \relates Enum
  *
@@ -35,6 +35,16 @@ inline size_t enumCount()
     return detail::EnumManager::instance().count();
 }
 
+inline size_t enumIndexCount()
+{
+    return detail::EnumManager::instance().indexCount();
+}
+
+inline const Enum* enumByIndex(size_t index)
+{
+    return detail::EnumManager::instance().getByIndex(index);
+}
+
 inline const Enum& enumByName(IdRef name)
 {
     return detail::EnumManager::instance().getByName(name);
@@ -109,14 +109,51 @@ private:
     ponder::String m_location; ///< Location of the error (file, line and function)
 };
 
+/**
+ * \brief Function handling the errors when exceptions are disabled
+ *
+ * \sa setErrorHandler()
+ */
+typedef void (*ErrorHandler)(const Error& error);
+
+/**
+ * \brief Set the function handling the errors when exceptions are disabled
+ *
+ * When Ponder is built without exceptions (PONDER_EXCEPTIONS is 0, see the CMake option
+ * PONDER_NO_EXCEPTIONS) errors can't be thrown, so they are passed to the handler instead.
+ * The handler must not return, e.g. it logs the error and exits. If it returns, or if there
+ * is no handler, the error is written to stderr and the program is aborted.
+ *
+ * Use the non-throwing functions, like Value::tryTo() or runtime::tryCall(), to handle
+ * errors which are expected.
+ *
+ * \param handler New error handler, or nullptr to restore the default
+ * \return Previous error handler
+ */
+PONDER_API ErrorHandler setErrorHandler(ErrorHandler handler);
+
+namespace detail {
+
+// Pass an error to the error handler, when exceptions are disabled.
+[[noreturn]] PONDER_API void raiseError(const Error& error);
+
+} // namespace detail
+
 } // namespace ponder
 
 #include <ponder/error.inl>
 
 /**
  * \brief Trigger a Ponder error
+ *
+ * The error is thrown, or passed to the error handler when exceptions are disabled.
  */
-#define PONDER_ERROR(error) throw ponder::Error::prepare(error, __FILE__, __LINE__, __func__)
+#if PONDER_EXCEPTIONS
+#   define PONDER_ERROR(error) throw ponder::Error::prepare(error, __FILE__, __LINE__, __func__)
+#else
+#   define PONDER_ERROR(error) \
+        ponder::detail::raiseError(ponder::Error::prepare(error, __FILE__, __LINE__, __func__))
+#endif
 
 
 #endif // PONDER_ERROR_HPP
@@ -92,6 +92,22 @@ public:
                 size_t index, IdRef functionName);
 };
 
+/**
+ * \brief Error thrown when binding a function to a C++ signature which is not its own
+ */
+class PONDER_API BadSignature : public BadType
+{
+public:
+
+    /**
+     * \brief Constructor
+     *
+     * \param functionName Name of the function
+     * \param paramCount Number of parameters of the requested signature
+     */
+    BadSignature(IdRef functionName, size_t paramCount);
+};
+
 /**
  * \brief Error thrown when a declaring a metaclass that already exists
  */
@@ -107,6 +123,21 @@ public:
     ClassAlreadyCreated(IdRef idType);
 };
 
+/**
+ * \brief Error thrown when modifying a metaclass that has been frozen
+ */
+class PONDER_API ClassFrozen : public Error
+{
+public:
+
+    /**
+     * \brief Constructor
+     *
+     * \param name Name of the class
+     */
+    ClassFrozen(IdRef name);
+};
+
 /**
  * \brief Error thrown when a metaclass couldn't be found (either by its name or its id)
  */
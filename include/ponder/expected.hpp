@@ -0,0 +1,196 @@
+/****************************************************************************
+**
+** This file is part of the Ponder library, formerly CAMP.
+**
+** The MIT License (MIT)
+**
+** Copyright (C) 2009-2014 TEGESO/TEGESOFT and/or its subsidiary(-ies) and mother company.
+** Copyright (C) 2015-2020 Nick Trout.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a copy
+** of this software and associated documentation files (the "Software"), to deal
+** in the Software without restriction, including without limitation the rights
+** to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+** copies of the Software, and to permit persons to whom the Software is
+** furnished to do so, subject to the following conditions:
+** 
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+** 
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+** OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+** THE SOFTWARE.
+**
+****************************************************************************/
+
+#pragma once
+#ifndef PONDER_EXPECTED_HPP
+#define PONDER_EXPECTED_HPP
+
+#include <ponder/config.hpp>
+#include <cassert>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace ponder {
+
+/**
+ * \brief Errors reported by the non-throwing functions, e.g. Value::tryTo()
+ *
+ * Each code is named after the Error class the throwing function would raise.
+ */
+enum class ErrorCode
+{
+    None,                   ///< No error
+    BadType,                ///< A value can't be converted to the requested type
+    BadArgument,            ///< An argument can't be converted to the parameter type
+    ClassNotFound,          ///< A type has no metaclass
+    ClassUnrelated,         ///< An object isn't an instance of the requested class
+    ConstructorNotFound,    ///< No constructor matches the arguments
+    ForbiddenRead,          ///< A property isn't readable
+    ForbiddenWrite,         ///< A property isn't writable
+    NotEnoughArguments,     ///< Too few arguments are passed to a function
+    NullObject,             ///< An object is null
+    OutOfRange,             ///< An index is out of range
+    PropertyNotFound        ///< A class has no property with the requested name
+};
+
+/**
+ * \brief Result of a non-throwing function: a value, or the code of the error
+ *
+ * \code
+ * ponder::Expected<int> count = value.tryTo<int>();
+ * if (count)
+ *     use(*count);
+ * else if (count.error() == ponder::ErrorCode::BadType)
+ *     ...
+ * \endcode
+ *
+ * \sa Value::tryTo(), UserObject::tryGet(), runtime::tryCall()
+ */
+template <typename T>
+class Expected
+{
+    static_assert(!std::is_same<T, ErrorCode>::value, "Expected error code is ambiguous");
+
+public:
+
+    /**
+     * \brief Construct a result holding a value
+     *
+     * \param value Value of the result
+     */
+    Expected(T value) : m_value(std::move(value)), m_error(ErrorCode::None) {}
+
+    /**
+     * \brief Construct a result holding an error
+     *
+     * \param error Code of the error, not ErrorCode::None
+     */
+    Expected(ErrorCode error) : m_error(error) {assert(error != ErrorCode::None);}
+
+    /**
+     * \brief Check if the result holds a value
+     *
+     * \return True if there was no error
+     */
+    bool hasValue() const {return m_error == ErrorCode::None;}
+
+    /**
+     * \brief Check if the result holds a value
+     *
+     * \return True if there was no error
+     */
+    explicit operator bool() const {return hasValue();}
+
+    /**
+     * \brief Get the code of the error
+     *
+     * \return Code of the error, or ErrorCode::None if the result holds a value
+     */
+    ErrorCode error() const {return m_error;}
+
+    /**
+     * \brief Get the value of the result, which must hold one
+     *
+     * \return Value of the result
+     */
+    const T& value() const & {assert(hasValue()); return *m_value;}
+    T& value() & {assert(hasValue()); return *m_value;}
+    T&& value() && {assert(hasValue()); return std::move(*m_value);}
+
+    const T& operator * () const & {return value();}
+    T& operator * () & {return value();}
+    T&& operator * () && {return std::move(*this).value();}
+    const T* operator -> () const {return &value();}
+    T* operator -> () {return &value();}
+
+    /**
+     * \brief Get the value of the result, or a default one if there was an error
+     *
+     * \param other Value returned when there was an error
+     * \return Value of the result or \a other
+     */
+    T valueOr(T other) const & {return hasValue() ? *m_value : std::move(other);}
+
+private:
+
+    std::optional<T> m_value;
+    ErrorCode m_error;
+};
+
+/**
+ * \brief Result of a non-throwing function returning nothing: success, or the code of
+ *        the error
+ */
+template <>
+class Expected<void>
+{
+public:
+
+    /**
+     * \brief Construct a successful result
+     */
+    Expected() : m_error(ErrorCode::None) {}
+
+    /**
+     * \brief Construct a result holding an error
+     *
+     * \param error Code of the error
+     */
+    Expected(ErrorCode error) : m_error(error) {}
+
+    /**
+     * \brief Check if the function succeeded
+     *
+     * \return True if there was no error
+     */
+    bool hasValue() const {return m_error == ErrorCode::None;}
+
+    /**
+     * \brief Check if the function succeeded
+     *
+     * \return True if there was no error
+     */
+    explicit operator bool() const {return hasValue();}
+
+    /**
+     * \brief Get the code of the error
+     *
+     * \return Code of the error, or ErrorCode::None if the function succeeded
+     */
+    ErrorCode error() const {return m_error;}
+
+private:
+
+    ErrorCode m_error;
+};
+
+} // namespace ponder
+
+#endif // PONDER_EXPECTED_HPP
@@ -34,6 +34,7 @@
 #include <ponder/config.hpp>
 #include <ponder/detail/getter.hpp>
 #include <ponder/args.hpp>
+#include <ponder/profiling.hpp>
 #include <ponder/type.hpp>
 #include <ponder/value.hpp>
 #include <string>
@@ -113,6 +114,18 @@ public:
      * \param visitor Visitor to accept
      */
     virtual void accept(ClassVisitor& visitor) const;
+
+    /**
+     * \brief Get the statistics of the calls to the function
+     *
+     * The calls are only measured when Ponder is built with PONDER_PROFILING, otherwise
+     * the statistics are empty.
+     *
+     * \return Statistics merged from all the threads which called the function
+     *
+     * \sa profiling::dump()
+     */
+    profiling::FunctionStats stats() const;
     
    /**
     * \brief Get the per-function uses data (internal)
@@ -133,6 +146,7 @@ protected:
     ValueKind m_returnType;             // Runtime return type
     policy::ReturnKind m_returnPolicy;  // Return policy
     const void *m_usesData;
+    profiling::detail::CallProfile m_profile; // Statistics of the calls
 };
     
 } // namespace ponder
@@ -0,0 +1,101 @@
+/****************************************************************************
+**
+** This file is part of the Ponder library, formerly CAMP.
+**
+** The MIT License (MIT)
+**
+** Copyright (C) 2009-2014 TEGESO/TEGESOFT and/or its subsidiary(-ies) and mother company.
+** Copyright (C) 2015-2020 Nick Trout.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a copy
+** of this software and associated documentation files (the "Software"), to deal
+** in the Software without restriction, including without limitation the rights
+** to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+** copies of the Software, and to permit persons to whom the Software is
+** furnished to do so, subject to the following conditions:
+** 
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+** 
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+** OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+** THE SOFTWARE.
+**
+****************************************************************************/
+
+#pragma once
+#ifndef PONDER_HASHEDID_HPP
+#define PONDER_HASHEDID_HPP
+
+#include <ponder/config.hpp>
+#include <ponder/detail/hash.hpp>
+
+namespace ponder {
+
+/**
+ * \brief Identifier with a hash computed at compile time
+ *
+ * A HashedId can be used to look up properties and functions instead of an IdRef. The hash
+ * is used directly by the lookup so no hashing is done at runtime. It is created with the
+ * `_pid` literal:
+ *
+ * \code
+ * using namespace ponder::literals;
+ * const ponder::Property& prop = metaclass.property("position"_pid);
+ * \endcode
+ *
+ * \note Lookups only benefit when the metaclass is frozen (see ClassBuilder::freeze), which
+ *       indexes member names by hash.
+ */
+class HashedId
+{
+public:
+
+    /**
+     * \brief Construct from a string
+     *
+     * \param str Characters of the identifier, which must outlive the HashedId
+     * \param len Length of the identifier
+     */
+    constexpr HashedId(const char* str, std::size_t len)
+        : m_name(str, len)
+        , m_hash(detail::hashString(str, len))
+    {}
+
+    /**
+     * \brief Get the identifier
+     */
+    constexpr detail::string_view name() const { return m_name; }
+
+    /**
+     * \brief Get the hash of the identifier, the same as detail::hashString()
+     */
+    constexpr std::uint64_t hash() const { return m_hash; }
+
+private:
+
+    detail::string_view m_name;
+    std::uint64_t m_hash;
+};
+
+namespace literals {
+
+/**
+ * \brief Create a HashedId from a string literal, e.g. `"position"_pid`
+ *
+ * \relates HashedId
+ */
+constexpr HashedId operator "" _pid(const char* str, std::size_t len)
+{
+    return HashedId(str, len);
+}
+
+} // namespace literals
+
+} // namespace ponder
+
+#endif // PONDER_HASHEDID_HPP
@@ -0,0 +1,116 @@
+/****************************************************************************
+**
+** This file is part of the Ponder library, formerly CAMP.
+**
+** The MIT License (MIT)
+**
+** Copyright (C) 2009-2014 TEGESO/TEGESOFT and/or its subsidiary(-ies) and mother company.
+** Copyright (C) 2015-2020 Nick Trout.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a copy
+** of this software and associated documentation files (the "Software"), to deal
+** in the Software without restriction, including without limitation the rights
+** to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+** copies of the Software, and to permit persons to whom the Software is
+** furnished to do so, subject to the following conditions:
+** 
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+** 
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+** OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+** THE SOFTWARE.
+**
+****************************************************************************/
+
+#pragma once
+#ifndef PONDER_MEMBERHANDLE_HPP
+#define PONDER_MEMBERHANDLE_HPP
+
+#include <ponder/config.hpp>
+
+namespace ponder {
+
+class Class;
+class Property;
+class Function;
+
+namespace detail {
+
+/**
+ * \brief Handle to a member of a metaclass
+ *
+ * A handle stores the slot of a member in its metaclass so that it can be accessed
+ * again without looking up its name. Handles are obtained from the metaclass, e.g.
+ * Class::propertyHandle().
+ *
+ * \note The slot is only stable whilst the metaclass is not modified. Take handles once
+ *       the metaclass is fully declared, ideally once it is frozen.
+ */
+template <typename T>
+class MemberHandle
+{
+public:
+
+    /**
+     * \brief Construct an invalid handle
+     */
+    MemberHandle() : m_class(nullptr), m_index(0) {}
+
+    /**
+     * \brief Check if the handle refers to a member
+     *
+     * \return True if valid
+     */
+    bool isValid() const { return m_class != nullptr; }
+
+    /**
+     * \brief Get the metaclass the handle belongs to
+     *
+     * \return Pointer to the metaclass, or nullptr if invalid
+     */
+    const Class* getClass() const { return m_class; }
+
+    /**
+     * \brief Get the index of the member in its metaclass
+     *
+     * \return Member index
+     */
+    size_t index() const { return m_index; }
+
+    bool operator == (const MemberHandle& other) const
+    {
+        return m_class == other.m_class && m_index == other.m_index;
+    }
+
+    bool operator != (const MemberHandle& other) const { return !(*this == other); }
+
+private:
+
+    friend class ponder::Class;
+
+    MemberHandle(const Class* cls, size_t index) : m_class(cls), m_index(index) {}
+
+    const Class* m_class;
+    size_t m_index;
+};
+
+} // namespace detail
+
+/**
+ * \brief Handle to a property of a metaclass, see Class::propertyHandle()
+ */
+typedef detail::MemberHandle<Property> PropertyHandle;
+
+/**
+ * \brief Handle to a function of a metaclass, see Class::functionHandle()
+ */
+typedef detail::MemberHandle<Function> FunctionHandle;
+
+} // namespace ponder
+
+#endif // PONDER_MEMBERHANDLE_HPP
@@ -36,6 +36,7 @@
 #include <ponder/config.hpp>
 #include "type.hpp"
 #include "detail/typeid.hpp"
+#include <atomic>
 
 namespace ponder {
 
@@ -44,6 +45,26 @@ namespace detail
     template <typename T> struct StaticTypeDecl;
     template <typename T> constexpr const char* staticTypeName(T&);
     PONDER_API void ensureTypeRegistered(TypeId const& id, void (*registerFunc)());
+    PONDER_API void registerTypeOnce(std::atomic<bool>& registered, TypeId const& id,
+                                     void (*registerFunc)());
+    PONDER_API void clearTypeRegistration(TypeId const& id);
+
+    // Once only registration of a type declared with PONDER_AUTO_TYPE().
+    //  - Once registered, checking is a single load of the flag.
+    //  - The first reference calls the registration function, serialised by a lock.
+    //  - The flag is cleared when the metaclass or metaenum is removed, so the next
+    //    reference registers the type again.
+    template <typename T>
+    struct AutoTypeRegistration
+    {
+        static inline std::atomic<bool> registered{false};
+
+        static void ensure(void (*registerFunc)())
+        {
+            if (!registered.load(std::memory_order_acquire))
+                registerTypeOnce(registered, calcTypeId<T>(), registerFunc);
+        }
+    };
 }
 
 /**
@@ -92,6 +113,9 @@ namespace detail
  * This is useful when you don't want to have to manually call an "init" function to
  * create your metaclass.
  *
+ * The registration function is called once, and again if the metaclass is undeclared and
+ * then requested. It is safe to reference the type from several threads.
+ *
  * Every type manipulated by Ponder must be registered with PONDER_TYPE(), PONDER_AUTO_TYPE()
  * or their NONCOPYABLE versions.
  *
@@ -122,17 +146,16 @@ namespace detail
     namespace ponder { namespace detail { \
         template<> struct StaticTypeDecl<TYPE> { \
             static TypeId id(bool checkRegister = true) { \
-                if (checkRegister) detail::ensureTypeRegistered(calcTypeId<TYPE>(), REGISTER_FN); \
+                if (checkRegister) AutoTypeRegistration<TYPE>::ensure(REGISTER_FN); \
                 return calcTypeId<TYPE>(); \
             } \
             static const char* name(bool checkRegister = true) { \
-                if (checkRegister) detail::ensureTypeRegistered(calcTypeId<TYPE>(), REGISTER_FN); \
+                if (checkRegister) AutoTypeRegistration<TYPE>::ensure(REGISTER_FN); \
                 return #TYPE; \
             } \
             static constexpr bool defined = true, copyable = true; \
         }; \
     }}
-    // TODO - ensureTypeRegistered() called every time referenced!
 
 /**
  * \brief Macro used to register a non-copyable C++ type to Ponder
@@ -188,6 +211,9 @@ namespace detail
  * This is useful when you don't want to have to manually call an "init" function to
  * create your metaclass.
  *
+ * The registration function is called once, and again if the metaclass is undeclared and
+ * then requested. It is safe to reference the type from several threads.
+ *
  * Every type manipulated by Ponder must be registered with PONDER_TYPE(), PONDER_AUTO_TYPE()
  * or their NONCOPYABLE versions.
  *
@@ -197,11 +223,11 @@ namespace detail
     namespace ponder { namespace detail { \
         template <> struct StaticTypeDecl<TYPE> { \
             static TypeId id(bool checkRegister = true) { \
-                if (checkRegister) detail::ensureTypeRegistered(calcTypeId<TYPE>(), REGISTER_FN); \
+                if (checkRegister) AutoTypeRegistration<TYPE>::ensure(REGISTER_FN); \
                 return calcTypeId<TYPE>(); \
             } \
             static const char* name(bool checkRegister = true) { \
-                if (checkRegister) detail::ensureTypeRegistered(calcTypeId<TYPE>(), REGISTER_FN); \
+                if (checkRegister) AutoTypeRegistration<TYPE>::ensure(REGISTER_FN); \
                 return #TYPE; \
             } \
             static constexpr bool defined = true, copyable = true; \
@@ -0,0 +1,237 @@
+/****************************************************************************
+**
+** This file is part of the Ponder library, formerly CAMP.
+**
+** The MIT License (MIT)
+**
+** Copyright (C) 2009-2014 TEGESO/TEGESOFT and/or its subsidiary(-ies) and mother company.
+** Copyright (C) 2015-2020 Nick Trout.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a copy
+** of this software and associated documentation files (the "Software"), to deal
+** in the Software without restriction, including without limitation the rights
+** to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+** copies of the Software, and to permit persons to whom the Software is
+** furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+** OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+** THE SOFTWARE.
+**
+****************************************************************************/
+
+#pragma once
+#ifndef PONDER_PROFILING_HPP
+#define PONDER_PROFILING_HPP
+
+#include <ponder/config.hpp>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <iosfwd>
+
+/**
+ * \namespace ponder::profiling
+ * \brief Profiling of reflected calls.
+ *
+ * Calls are only measured when Ponder is built with PONDER_PROFILING defined to 1 (the
+ * CMake option of the same name). Otherwise the instrumentation is compiled out and the
+ * statistics stay empty.
+ */
+
+namespace ponder {
+namespace profiling {
+
+namespace detail {
+class CallProfile;
+}
+
+/**
+ * \brief Histogram of latencies, in nanoseconds
+ *
+ * Values are counted in logarithmic buckets: each power of two is split in 2^subBucketBits
+ * sub-buckets, so a value is known within 1/2^subBucketBits of its magnitude whatever it
+ * is. Values of maxValue and above go to the last bucket.
+ */
+class PONDER_API Histogram
+{
+public:
+
+    /// Sub-buckets per power of two, as a power of two
+    static constexpr unsigned subBucketBits = 4;
+
+    /// Largest value counted exactly, about 18 minutes
+    static constexpr std::uint64_t maxValue = (std::uint64_t(1) << 40) - 1;
+
+    /// Number of buckets
+    static constexpr size_t bucketCount = (40 - subBucketBits + 1) << subBucketBits;
+
+    /**
+     * \brief Get the bucket counting a value
+     *
+     * \param value Value to count
+     * \return Index of the bucket
+     */
+    static size_t bucketIndex(std::uint64_t value);
+
+    /**
+     * \brief Get the largest value counted in a bucket
+     *
+     * \param index Index of the bucket
+     * \return Largest value of the bucket
+     */
+    static std::uint64_t bucketMax(size_t index);
+
+    /**
+     * \brief Count a value
+     *
+     * \param value Value to count
+     */
+    void record(std::uint64_t value) {++m_counts[bucketIndex(value)];}
+
+    /**
+     * \brief Add the values counted by another histogram
+     *
+     * \param other Histogram to add
+     */
+    void merge(const Histogram& other);
+
+    /**
+     * \brief Get the number of values counted
+     *
+     * \return Number of values
+     */
+    std::uint64_t count() const;
+
+    /**
+     * \brief Get the number of values counted in a bucket
+     *
+     * \param index Index of the bucket
+     * \return Number of values in the bucket
+     */
+    std::uint64_t bucketCountAt(size_t index) const {return m_counts[index];}
+
+    /**
+     * \brief Get a percentile of the values counted
+     *
+     * \param percent Percentile, from 0 to 100
+     * \return Largest value of the bucket holding the percentile, or 0 if there is no value
+     */
+    std::uint64_t percentile(double percent) const;
+
+private:
+
+    friend class detail::CallProfile;
+
+    std::array<std::uint64_t, bucketCount> m_counts {};
+};
+
+/**
+ * \brief Statistics of the calls to a function
+ *
+ * \sa Function::stats()
+ */
+struct PONDER_API FunctionStats
+{
+    std::uint64_t calls = 0;        ///< Number of calls
+    std::uint64_t exceptions = 0;   ///< Number of calls which threw an exception
+    std::uint64_t totalNs = 0;      ///< Cumulative time spent in the calls, in nanoseconds
+    Histogram latency;              ///< Latencies of the calls, in nanoseconds
+
+    /**
+     * \brief Get the mean latency of the calls
+     *
+     * \return Mean latency in nanoseconds, or 0 if there was no call
+     */
+    double meanNs() const {return calls ? double(totalNs) / double(calls) : 0.0;}
+};
+
+/**
+ * \brief Write the statistics of the functions of all the registered classes, as JSON
+ *
+ * Only the functions that were called are reported:
+ *
+ * \code
+ * {"functions": [
+ *   {"class": "MyClass", "function": "update", "calls": 1200, "exceptions": 0,
+ *    "totalNs": 84000, "meanNs": 70.0, "p50Ns": 63, "p90Ns": 95, "p99Ns": 159,
+ *    "p999Ns": 703, "maxNs": 1535}
+ * ]}
+ * \endcode
+ *
+ * \param stream Stream to write to
+ */
+PONDER_API void dump(std::ostream& stream);
+
+namespace detail {
+
+/*
+ * Statistics of the calls to one function. They are recorded in a shard per thread, so
+ * calls don't contend, and merged when read.
+ */
+class PONDER_API CallProfile
+{
+public:
+
+    CallProfile();
+    ~CallProfile();
+
+    CallProfile(const CallProfile&) = delete;
+
+    // Record a call, from any thread.
+    void record(std::uint64_t ns, bool threw) const;
+
+    // Merge the statistics of all the threads.
+    FunctionStats stats() const;
+
+private:
+
+    const size_t m_index; // Index of the function in the shards
+};
+
+/*
+ * Time the scope of a call, which threw if it is left by an exception.
+ */
+class CallTimer
+{
+public:
+
+    explicit CallTimer(const CallProfile* profile)
+        : m_profile(profile)
+        , m_exceptions(std::uncaught_exceptions())
+        , m_start(std::chrono::steady_clock::now())
+    {}
+
+    ~CallTimer()
+    {
+        if (m_profile)
+        {
+            const auto elapsed = std::chrono::steady_clock::now() - m_start;
+            m_profile->record(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count(),
+                              std::uncaught_exceptions() > m_exceptions);
+        }
+    }
+
+    CallTimer(const CallTimer&) = delete;
+
+private:
+
+    const CallProfile* m_profile;
+    const int m_exceptions;
+    const std::chrono::steady_clock::time_point m_start;
+};
+
+} // namespace detail
+
+} // namespace profiling
+} // namespace ponder
+
+#endif // PONDER_PROFILING_HPP
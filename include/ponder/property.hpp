@@ -33,11 +33,84 @@
 
 
 #include <ponder/value.hpp>
+#include <ponder/expected.hpp>
+#include <ponder/detail/typeid.hpp>
 
 namespace ponder
 {
 
 class ClassVisitor;
+class Property;
+
+namespace detail {
+
+// Typed access functions of a property, shared by all TypedPropertyRef<T> bound to it.
+template <typename T>
+struct TypedPropertyAccess
+{
+    T (*get)(const Property& property, const UserObject& object);
+    void (*set)(const Property& property, const UserObject& object, const T& value); // null if read-only
+};
+
+} // namespace detail
+
+/**
+ * \brief Reference to a property, bound to its C++ type
+ *
+ * A TypedPropertyRef reads and writes the property as a T, directly through its
+ * accessor, without boxing the value in a Value or converting it. The type is checked
+ * once, when the reference is bound with Property::typed().
+ *
+ * \code
+ * const ponder::TypedPropertyRef<int> age = metaclass.property("age").typed<int>();
+ * age.set(object, age.get(object) + 1);
+ * \endcode
+ *
+ * \sa Property::typed
+ */
+template <typename T>
+class TypedPropertyRef
+{
+public:
+
+    /**
+     * \brief Get the property this reference is bound to
+     *
+     * \return Reference to the property
+     */
+    const Property& property() const {return *m_property;}
+
+    /**
+     * \brief Get the current value of the property for a given object
+     *
+     * \param object Object
+     *
+     * \return Value of the property
+     *
+     * \throw NullObject object is invalid
+     */
+    T get(const UserObject& object) const;
+
+    /**
+     * \brief Set the current value of the property for a given object
+     *
+     * \param object Object
+     * \param value New value to assign to the property
+     *
+     * \throw NullObject object is invalid
+     * \throw ForbiddenWrite property is not writable
+     */
+    void set(const UserObject& object, const T& value) const;
+
+private:
+
+    friend class Property;
+
+    TypedPropertyRef(const Property& property, const detail::TypedPropertyAccess<T>& access);
+
+    const Property* m_property;
+    const detail::TypedPropertyAccess<T>* m_access;
+};
 
 /**
  * \brief Abstract representation of a property
@@ -109,6 +182,76 @@ public:
      */
     void set(const UserObject& object, const Value& value) const;
 
+    /**
+     * \brief Get the current value of the property for a given object, without throwing
+     *
+     * \param object Object
+     *
+     * \return Value of the property, or ErrorCode::NullObject, ErrorCode::ClassUnrelated,
+     *         ErrorCode::ForbiddenRead...
+     *
+     * \sa get()
+     */
+    Expected<Value> tryGet(const UserObject& object) const;
+
+    /**
+     * \brief Set the current value of the property for a given object, without throwing
+     *
+     * \param object Object
+     * \param value New value to assign to the property
+     *
+     * \return Nothing, or ErrorCode::NullObject, ErrorCode::ClassUnrelated,
+     *         ErrorCode::ForbiddenWrite, ErrorCode::BadType...
+     *
+     * \sa set()
+     */
+    Expected<void> trySet(const UserObject& object, const Value& value) const;
+
+    /**
+     * \brief Bind a reference to the property for its C++ type
+     *
+     * Only simple properties can be bound, and T must be exactly the type of the
+     * property, without reference or const qualifiers.
+     *
+     * \return Typed reference to the property
+     *
+     * \throw BadType T is not the type of the property
+     *
+     * \sa TypedPropertyRef
+     */
+    template <typename T>
+    TypedPropertyRef<T> typed() const;
+
+    /**
+     * \brief Get the current value of the property as a T, without boxing it in a Value
+     *
+     * \param object Object
+     *
+     * \return Value of the property
+     *
+     * \throw BadType T is not the type of the property
+     * \throw NullObject object is invalid
+     *
+     * \sa typed
+     */
+    template <typename T>
+    T getAs(const UserObject& object) const {return typed<T>().get(object);}
+
+    /**
+     * \brief Set the current value of the property from a T, without boxing it in a Value
+     *
+     * \param object Object
+     * \param value New value to assign to the property
+     *
+     * \throw BadType T is not the type of the property
+     * \throw NullObject object is invalid
+     * \throw ForbiddenWrite property is not writable
+     *
+     * \sa typed
+     */
+    template <typename T>
+    void setAs(const UserObject& object, const T& value) const {typed<T>().set(object, value);}
+
     /**
      * \brief Accept the visitation of a ClassVisitor
      *
@@ -150,6 +293,31 @@ protected:
      */
     virtual void setValue(const UserObject& object, const Value& value) const = 0;
 
+    /**
+     * \brief Get the typed access functions of the property
+     *
+     * The default implementation returns null: the property can't be accessed by type.
+     *
+     * \param type Type to access the property as
+     *
+     * \return Pointer to a detail::TypedPropertyAccess for \a type, or null if the
+     *         property is not of this type
+     */
+    virtual const void* typedAccess(TypeId type) const;
+
+    /**
+     * \brief Check that the value can be read or written without error
+     *
+     * This is used by tryGet() and trySet() to report errors rather than throw them. The
+     * default implementation only checks that the object isn't null.
+     *
+     * \param object Object
+     * \param value New value to write, or null to check a read
+     *
+     * \return ErrorCode::None, or the error which getValue() or setValue() would raise
+     */
+    virtual ErrorCode checkAccess(const UserObject& object, const Value* value) const;
+
 private:
 
     Id m_name; // Name of the property
@@ -158,5 +326,6 @@ private:
 
 } // namespace ponder
 
+#include <ponder/property.inl>
 
 #endif // PONDER_PROPERTY_HPP
@@ -0,0 +1,66 @@
+/****************************************************************************
+**
+** This file is part of the Ponder library, formerly CAMP.
+**
+** The MIT License (MIT)
+**
+** Copyright (C) 2009-2014 TEGESO/TEGESOFT and/or its subsidiary(-ies) and mother company.
+** Copyright (C) 2015-2020 Nick Trout.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a copy
+** of this software and associated documentation files (the "Software"), to deal
+** in the Software without restriction, including without limitation the rights
+** to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+** copies of the Software, and to permit persons to whom the Software is
+** furnished to do so, subject to the following conditions:
+** 
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+** 
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+** OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+** THE SOFTWARE.
+**
+****************************************************************************/
+
+
+namespace ponder {
+
+template <typename T>
+TypedPropertyRef<T>::TypedPropertyRef(const Property& property,
+                                      const detail::TypedPropertyAccess<T>& access)
+    : m_property(&property)
+    , m_access(&access)
+{
+}
+
+template <typename T>
+inline T TypedPropertyRef<T>::get(const UserObject& object) const
+{
+    return m_access->get(*m_property, object);
+}
+
+template <typename T>
+inline void TypedPropertyRef<T>::set(const UserObject& object, const T& value) const
+{
+    if (!m_access->set)
+        PONDER_ERROR(ForbiddenWrite(m_property->name()));
+
+    m_access->set(*m_property, object, value);
+}
+
+template <typename T>
+TypedPropertyRef<T> Property::typed() const
+{
+    const void* access = typedAccess(detail::calcTypeId<T>());
+    if (!access)
+        PONDER_ERROR(BadType(mapType<T>(), kind()));
+
+    return TypedPropertyRef<T>(*this, *static_cast<const detail::TypedPropertyAccess<T>*>(access));
+}
+
+} // namespace ponder
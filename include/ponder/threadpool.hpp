@@ -0,0 +1,221 @@
+/****************************************************************************
+**
+** This file is part of the Ponder library, formerly CAMP.
+**
+** The MIT License (MIT)
+**
+** Copyright (C) 2009-2014 TEGESO/TEGESOFT and/or its subsidiary(-ies) and mother company.
+** Copyright (C) 2015-2020 Nick Trout.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a copy
+** of this software and associated documentation files (the "Software"), to deal
+** in the Software without restriction, including without limitation the rights
+** to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+** copies of the Software, and to permit persons to whom the Software is
+** furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+** OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+** THE SOFTWARE.
+**
+****************************************************************************/
+
+#pragma once
+#ifndef PONDER_THREADPOOL_HPP
+#define PONDER_THREADPOOL_HPP
+
+#include <ponder/config.hpp>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * \namespace ponder::parallel
+ * \brief Parallel execution of reflected calls.
+ */
+
+namespace ponder {
+namespace parallel {
+
+/**
+ * \brief Interface of the objects which run tasks
+ *
+ * Derive from it to run asynchronous calls elsewhere than on a ThreadPool, e.g. on the
+ * task system of an application.
+ *
+ * \sa ThreadPool, runtime::callAsync()
+ */
+class PONDER_API Executor
+{
+public:
+
+    /**
+     * \brief Task run by an executor
+     */
+    typedef std::function<void()> Task;
+
+    /**
+     * \brief Destructor
+     */
+    virtual ~Executor() {}
+
+    /**
+     * \brief Queue a task, to be run later, possibly on another thread
+     *
+     * \param task Task to run. It must not throw.
+     */
+    virtual void submit(Task task) = 0;
+};
+
+/**
+ * \brief Work-stealing pool of worker threads
+ *
+ * Each worker has a queue of tasks. A worker runs its own tasks newest first, and when
+ * it has none it steals the oldest task of another worker. Tasks submitted from outside
+ * the pool are spread over the workers.
+ *
+ * A thread waiting for tasks with forRange() or wait() runs pending tasks while it waits,
+ * so pools may be used from their own tasks, and a pool without workers runs everything on
+ * the calling thread. A task must not block on a future of its own pool any other way, e.g.
+ * with std::future::get(): the task it waits for may be queued behind it, and with one
+ * worker, as the default pool has on a single core machine, it would never run.
+ *
+ * \code
+ * ponder::parallel::ThreadPool pool(4);
+ * pool.forRange(objects.size(), 64, [&](size_t begin, size_t end)
+ * {
+ *     for (size_t i = begin; i < end; ++i)
+ *         update(objects[i]);
+ * });
+ * \endcode
+ *
+ * \sa ponder::parallel::forEach
+ */
+class PONDER_API ThreadPool : public Executor
+{
+public:
+
+    /**
+     * \brief Body of a parallel loop, called with ranges [begin, end)
+     */
+    typedef std::function<void(size_t begin, size_t end)> RangeBody;
+
+    /**
+     * \brief Construct the pool and start its workers
+     *
+     * \param workerCount Number of worker threads, may be zero
+     */
+    explicit ThreadPool(size_t workerCount);
+
+    /**
+     * \brief Destructor
+     *
+     * Pending tasks are run, then the workers are stopped.
+     */
+    ~ThreadPool() override;
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator = (const ThreadPool&) = delete;
+
+    /**
+     * \brief Get the number of worker threads
+     *
+     * \return Number of workers
+     */
+    size_t workerCount() const {return m_threads.size();}
+
+    /**
+     * \brief Queue a task, to be run by a worker
+     *
+     * \param task Task to run. It must not throw.
+     */
+    void submit(Task task) override;
+
+    /**
+     * \brief Run a pending task on the calling thread, if there is one
+     *
+     * \return True if a task was run
+     */
+    bool runPendingTask();
+
+    /**
+     * \brief Wait for a future, running pending tasks meanwhile
+     *
+     * Use this to wait, from a task of the pool, for a result computed by the pool, e.g. a
+     * runtime::callAsync().
+     *
+     * \param future Future to wait for
+     * \return The value of the future
+     * \throw The exception stored in the future
+     */
+    template <typename T>
+    T wait(std::future<T>& future)
+    {
+        while (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        {
+            // Nothing to run, the result is computed by another thread
+            if (!runPendingTask())
+                future.wait_for(std::chrono::microseconds(100));
+        }
+        return future.get();
+    }
+
+    /**
+     * \brief Run a loop over [0, count) in parallel and wait for it to complete
+     *
+     * The range is split into shards of at least \a grain indices, a few per thread so that
+     * threads which finish first can steal the rest. The calling thread runs shards too.
+     *
+     * \param count Number of indices
+     * \param grain Minimum number of indices in a shard
+     * \param body Function called for each shard
+     *
+     * \throw If body throws, the remaining shards are skipped and the first exception is
+     *        rethrown once the running ones are complete.
+     */
+    void forRange(size_t count, size_t grain, const RangeBody& body);
+
+    /**
+     * \brief Get the default pool
+     *
+     * The default pool is created on first use, with one worker less than the number of
+     * hardware threads, as the calling thread also runs tasks, and at least one worker so
+     * that submitted tasks are run asynchronously.
+     *
+     * \return The default pool
+     */
+    static ThreadPool& defaultPool();
+
+private:
+
+    struct Queue;
+
+    void workerLoop(size_t index);
+    bool popTask(size_t index, Task& task);
+
+    std::vector<std::unique_ptr<Queue>> m_queues; // Task queue of each worker
+    std::vector<std::thread> m_threads;
+    std::atomic<ptrdiff_t> m_pending;   // Number of queued tasks
+    std::atomic<size_t> m_nextQueue;    // Queue of the next task submitted from outside
+    std::mutex m_mutex;                 // Guards waiting for tasks
+    std::condition_variable m_wake;     // Signalled when tasks are queued
+    bool m_stop;
+};
+
+} // namespace parallel
+} // namespace ponder
+
+#endif // PONDER_THREADPOOL_HPP
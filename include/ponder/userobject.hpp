@@ -31,9 +31,11 @@
 #ifndef PONDER_USEROBJECT_HPP
 #define PONDER_USEROBJECT_HPP
 
-#include <ponder/args.hpp>
 #include <ponder/classcast.hpp>
 #include <ponder/errors.hpp>
+#include <ponder/expected.hpp>
+#include <ponder/memberhandle.hpp>
+#include <ponder/hashedid.hpp>
 #include <ponder/detail/objecttraits.hpp>
 #include <ponder/detail/objectholder.hpp>
 #include <ponder/detail/util.hpp>
@@ -54,7 +56,8 @@ class ParentObject;
  *
  * \note UserObjects are stored interally as objects (a copy) or references (an existing 
  *       object). To be sure which you are constructing use UserObject::makeRef() or
- *       UserObject::makeCopy().
+ *       UserObject::makeCopy(). References are stored inline, without allocation. Copies
+ *       are held in shared storage.
  *
  * \sa EnumObject
  */
@@ -99,6 +102,29 @@ public:
     template <typename T>
     static UserObject makeOwned(T&& object);
 
+    /**
+     * \brief Construct a user object with a copy of an object, shared until written
+     *
+     * Copies of the returned user object share one copy of \a object. A copy is only
+     * duplicated when it is written to, by set() or ref(). This makes passing large
+     * objects by value, e.g. in a Value or Args, cheap.
+     *
+     * \note Writes made through references to members of the object, e.g. a nested
+     *       user property, are not detected and are seen by all the copies. So are writes
+     *       through get() and pointer(), and through an object passed by non-const
+     *       reference as an argument of a reflected call. The called object of a reflected
+     *       call is made unshared first, see writableRef().
+     *
+     * \note Sharing is checked with the reference count, so a copy on write object must not
+     *       be written while other threads copy it or its copies.
+     *
+     * \param object Instance to store in the user object
+     *
+     * \return UserObject containing a copy of \a object, copied on write
+     */
+    template <typename T>
+    static UserObject makeCopyOnWrite(const T& object);
+
     /**
      * \brief Default constructor
      *
@@ -173,6 +199,15 @@ public:
     template <typename T>
     typename detail::TypeTraits<T>::ReferenceType get() const;
 
+    /**
+     * \brief Check that the object can be retrieved as a T, without throwing
+     *
+     * \return ErrorCode::None if get<T>() succeeds, or ErrorCode::NullObject,
+     *         ErrorCode::ClassNotFound or ErrorCode::ClassUnrelated
+     */
+    template <typename T>
+    ErrorCode checkGet() const;
+
     /**
      * \brief Retrieve the address of the stored object
      *
@@ -205,6 +240,17 @@ public:
     template <typename T>
     T& ref() const;
 
+    /**
+     * \brief Get a reference to the object, to write it
+     *
+     * A copy on write object is first made unshared, as by ref(). The returned user object
+     * references the object without owning it, so it must not outlive this one. Reflected
+     * calls pass the called object like this, so that the caller sees the writes.
+     *
+     * \return User object referencing the stored object
+     */
+    UserObject writableRef() const;
+
     /**
      * \brief Retrieve the metaclass of the stored instance
      *
@@ -244,6 +290,31 @@ public:
      */
     Value get(size_t index) const;
 
+    /**
+     * \brief Get the value of an object's property from a handle
+     *
+     * This avoids looking up the property by name, see Class::propertyHandle().
+     *
+     * \param handle Handle of the property, from this object's metaclass
+     *
+     * \return Current value of the property
+     *
+     * \throw ForbiddenRead \a property is not readable
+     */
+    Value get(PropertyHandle handle) const;
+
+    /**
+     * \brief Get the value of an object's property by name, hashed at compile time
+     *
+     * \param property Name of the property to get, e.g. `"p"_pid`
+     *
+     * \return Current value of the property
+     *
+     * \throw PropertyNotFound \a property is not a property of the object
+     * \throw ForbiddenRead \a property is not readable
+     */
+    Value get(HashedId property) const;
+
     /**
      * \brief Set the value of an object's property by name
      *
@@ -274,6 +345,77 @@ public:
      */
     void set(size_t index, const Value& value) const;
 
+    /**
+     * \brief Set the value of an object's property from a handle
+     *
+     * This avoids looking up the property by name, see Class::propertyHandle().
+     *
+     * \param handle Handle of the property, from this object's metaclass
+     * \param value Value to set
+     *
+     * \throw ForbiddenWrite \a property is not writable
+     * \throw BadType \a value can't be converted to the property's type
+     */
+    void set(PropertyHandle handle, const Value& value) const;
+
+    /**
+     * \brief Set the value of an object's property by name, hashed at compile time
+     *
+     * \param property Name of the property to set, e.g. `"p"_pid`
+     * \param value Value to set
+     *
+     * \throw PropertyNotFound \a property is not a property of the object
+     * \throw ForbiddenWrite \a property is not writable
+     * \throw BadType \a value can't be converted to the property's type
+     */
+    void set(HashedId property, const Value& value) const;
+
+    /**
+     * \brief Get the value of an object's property by name, without throwing
+     *
+     * \param property Name of the property to get
+     *
+     * \return Current value of the property, or ErrorCode::NullObject,
+     *         ErrorCode::PropertyNotFound, ErrorCode::ForbiddenRead...
+     *
+     * \sa get(), Property::tryGet()
+     */
+    Expected<Value> tryGet(IdRef property) const;
+
+    /**
+     * \brief Get the value of an object's property by name, hashed at compile time, without
+     *        throwing
+     *
+     * \param property Name of the property to get, e.g. `"p"_pid`
+     *
+     * \return Current value of the property, or the code of the error
+     */
+    Expected<Value> tryGet(HashedId property) const;
+
+    /**
+     * \brief Set the value of an object's property by name, without throwing
+     *
+     * \param property Name of the property to set
+     * \param value Value to set
+     *
+     * \return Nothing, or ErrorCode::NullObject, ErrorCode::PropertyNotFound,
+     *         ErrorCode::ForbiddenWrite, ErrorCode::BadType...
+     *
+     * \sa set(), Property::trySet()
+     */
+    Expected<void> trySet(IdRef property, const Value& value) const;
+
+    /**
+     * \brief Set the value of an object's property by name, hashed at compile time, without
+     *        throwing
+     *
+     * \param property Name of the property to set, e.g. `"p"_pid`
+     * \param value Value to set
+     *
+     * \return Nothing, or the code of the error
+     */
+    Expected<void> trySet(HashedId property, const Value& value) const;
+
     /**
      * \brief Operator == to compare equality between two user objects
      *
@@ -311,19 +453,68 @@ private:
 
     friend class Property;
 
+    // How the object is stored
+    enum class Storage : unsigned char
+    {
+        None,       // Empty object
+        Ref,        // Reference to an existing object, inline
+        ConstRef,   // Const reference to an existing object, inline
+        Owned,      // Object owned by the holder
+        CopyOnWrite // Object owned by the holder, duplicated when written if shared
+    };
+
      // Assign a new value to a property of the object
     void set(const Property& property, const Value& value) const;
 
-    UserObject(const Class* cls, detail::AbstractObjectHolder* h)
+    // Owned object
+    UserObject(const Class* cls, std::shared_ptr<detail::AbstractObjectHolder> h,
+               Storage storage)
         :   m_class(cls)
-        ,   m_holder(h)
+        ,   m_pointer(h->object())
+        ,   m_holder(std::move(h))
+        ,   m_storage(storage)
     {}
+
+    // Make an owned object, allocating the holder from the class's memory resource
+    template <typename H, typename... A>
+    static UserObject makeHolder(const Class& cls, Storage storage, A&&... args);
+
+    // Make sure the object is not shared, before it is written to
+    void makeWritable() const
+    {
+        if (m_storage == Storage::CopyOnWrite && m_holder.use_count() > 1)
+            detach();
+    }
+
+    // Replace the shared object with a copy of it
+    void detach() const;
+
+    // Get the memory resource of a metaclass (Class is incomplete here)
+    static std::pmr::memory_resource* memoryResource(const Class& cls);
+
+    // Referenced object
+    UserObject(const Class* cls, void* pointer, Storage storage)
+        :   m_class(cls)
+        ,   m_pointer(pointer)
+        ,   m_holder()
+        ,   m_storage(storage)
+    {}
+
+    // Make a reference from an object of static type T and dynamic class cls
+    template <typename T>
+    static UserObject makeRefTo(T* object, const Class& cls);
  
     // Metaclass of the stored object
     const Class* m_class;
+
+    // Pointer to the stored object, adjusted to the most derived class. Mutable, as the
+    // object is replaced by a copy when written if it is copied on write.
+    mutable void* m_pointer;
     
-    // Optional abstract holder storing the object
-    std::shared_ptr<detail::AbstractObjectHolder> m_holder;
+    // Holder owning the object, if it is owned
+    mutable std::shared_ptr<detail::AbstractObjectHolder> m_holder;
+
+    Storage m_storage;
 };
 
 } // namespace ponder
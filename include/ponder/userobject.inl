@@ -31,24 +31,24 @@ namespace ponder {
     
 template <typename T>
 UserObject::UserObject(const T& object)
-    :   m_class(&classByType<T>())
+    :   UserObject(makeCopy(object))
 {
-    typedef detail::TypeTraits<const T> PropTraits;
-    typedef detail::ObjectHolderByCopy<typename PropTraits::DataType> Holder;
-    m_holder.reset(new Holder(PropTraits::getPointer(object)));
 }
 
 template <typename T>
 UserObject::UserObject(T* object)
     :   m_class(&classByType<T>())
+    ,   m_pointer(nullptr)
+    ,   m_holder()
+    ,   m_storage(std::is_const<T>::value ? Storage::ConstRef : Storage::Ref)
 {
     typedef detail::TypeTraits<T> PropTraits;
     static_assert(!PropTraits::isRef, "Cannot make reference to reference");
-    
-    typedef typename std::conditional<std::is_const<T>::value,
-    detail::ObjectHolderByConstRef<typename PropTraits::DataType>,
-    detail::ObjectHolderByRef<typename PropTraits::DataType>>::type Holder;    
-    m_holder.reset(new Holder(object));
+
+    // Point at the most derived part of the object (may differ with multiple inheritance)
+    typedef typename PropTraits::DataType DataType;
+    DataType* ptr = const_cast<DataType*>(object);
+    m_pointer = classCast(ptr, classByType<DataType>(), classByObject(object));
 }
 
 template <typename T>
@@ -70,17 +70,36 @@ typename detail::TypeTraits<T>::ReferenceType UserObject::get() const
     return detail::TypeTraits<T>::get(ptr);
 }
 
+template <typename T>
+ErrorCode UserObject::checkGet() const
+{
+    if (!pointer())
+        return ErrorCode::NullObject;
+
+    const Class *targetClass = classByTypeSafe<T>();
+    if (!targetClass)
+        return ErrorCode::ClassNotFound;
+
+    return canClassCast(*m_class, *targetClass) ? ErrorCode::None : ErrorCode::ClassUnrelated;
+}
+
 template <typename T>
 inline UserObject UserObject::makeRef(T& object)
 {
     typedef detail::TypeTraits<T> TypeTraits;
     static_assert(!TypeTraits::isRef, "Cannot make reference to reference");
 
-    typedef typename std::conditional<std::is_const<T>::value,
-                 detail::ObjectHolderByConstRef<typename TypeTraits::DataType>,
-                 detail::ObjectHolderByRef<typename TypeTraits::DataType>>::type Holder;
+    return makeRefTo(TypeTraits::getPointer(object), classByObject(object));
+}
+
+template <typename T>
+inline UserObject UserObject::makeRefTo(T* object, const Class& cls)
+{
+    typedef typename std::remove_const<T>::type DataType;
 
-    return UserObject(&classByObject(object), new Holder(TypeTraits::getPointer(object)));
+    // Point at the most derived part of the object (may differ with multiple inheritance)
+    void* ptr = classCast(const_cast<DataType*>(object), classByType<DataType>(), cls);
+    return UserObject(&cls, ptr, std::is_const<T>::value ? Storage::ConstRef : Storage::Ref);
 }
 
 template <typename T>
@@ -94,7 +113,7 @@ inline UserObject UserObject::makeCopy(const T& object)
 {
     typedef detail::TypeTraits<const T> PropTraits;
     typedef detail::ObjectHolderByCopy<typename PropTraits::DataType> Holder;
-    return UserObject(&classByType<T>(), new Holder(PropTraits::getPointer(object)));
+    return makeHolder<Holder>(classByType<T>(), Storage::Owned, PropTraits::getPointer(object));
 }
 
 template <typename T>
@@ -102,19 +121,38 @@ inline UserObject UserObject::makeOwned(T&& object)
 {
     typedef detail::TypeTraits<const T> PropTraits;
     typedef detail::ObjectHolderByCopy<typename PropTraits::DataType> Holder;
-    return UserObject(&classByType<T>(), new Holder(std::forward<T>(object)));
+    return makeHolder<Holder>(classByType<T>(), Storage::Owned, std::forward<T>(object));
+}
+
+template <typename T>
+inline UserObject UserObject::makeCopyOnWrite(const T& object)
+{
+    typedef detail::TypeTraits<const T> PropTraits;
+    typedef detail::ObjectHolderByCopy<typename PropTraits::DataType> Holder;
+    return makeHolder<Holder>(classByType<T>(), Storage::CopyOnWrite,
+                              PropTraits::getPointer(object));
+}
+
+template <typename H, typename... A>
+inline UserObject UserObject::makeHolder(const Class& cls, Storage storage, A&&... args)
+{
+    // Holder and shared count in one allocation.
+    std::pmr::polymorphic_allocator<H> allocator(memoryResource(cls));
+    return UserObject(&cls, std::allocate_shared<H>(allocator, std::forward<A>(args)...),
+                      storage);
 }
 
 template <typename T>
 inline T& UserObject::ref() const
 {
-    return *reinterpret_cast<T*>(m_holder->object());
+    makeWritable();
+    return *reinterpret_cast<T*>(m_pointer);
 }
 
 template <typename T>
 inline const T& UserObject::cref() const
 {
-    return *reinterpret_cast<T*>(m_holder->object());
+    return *reinterpret_cast<T*>(m_pointer);
 }
 
 } // namespace ponder
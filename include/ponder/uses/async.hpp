@@ -0,0 +1,260 @@
+/****************************************************************************
+**
+** This file is part of the Ponder library.
+**
+** The MIT License (MIT)
+**
+** Copyright (C) 2009-2014 TEGESO/TEGESOFT and/or its subsidiary(-ies) and mother company.
+** Copyright (C) 2015-2020 Nick Trout.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a copy
+** of this software and associated documentation files (the "Software"), to deal
+** in the Software without restriction, including without limitation the rights
+** to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+** copies of the Software, and to permit persons to whom the Software is
+** furnished to do so, subject to the following conditions:
+** 
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+** 
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+** OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+** THE SOFTWARE.
+**
+****************************************************************************/
+
+/**
+ * \file
+ * \brief Asynchronous calls of Ponder registered functions.
+ */
+
+#pragma once
+#ifndef PONDER_USES_ASYNC_HPP
+#define PONDER_USES_ASYNC_HPP
+
+#include <ponder/threadpool.hpp>
+#include <ponder/uses/runtime.hpp>
+#include <exception>
+#include <future>
+#include <memory>
+
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L && __has_include(<coroutine>)
+#   include <coroutine>
+#   define PONDER_USES_ASYNC_COROUTINES 1
+#endif
+
+namespace ponder {
+namespace runtime {
+namespace detail {
+
+// Call bound to its arguments, run by the executor.
+typedef std::function<Value()> BoundCall;
+
+template <typename... A>
+inline BoundCall bindCall(const Function& fn, const UserObject& obj, A&&... args)
+{
+    // Arguments are packed on the calling thread, the object is referenced. The reference
+    // is taken here, so the call writes the caller's object, which the copy keeps alive.
+    return [&fn, ref = obj.writableRef(), owner = obj,
+            callArgs = ArgsBuilder<A...>::makeArgs(std::forward<A>(args)...)]
+    {
+        return runtime::ObjectCaller(fn).call(ref, callArgs);
+    };
+}
+
+template <typename... A>
+inline BoundCall bindStaticCall(const Function& fn, A&&... args)
+{
+    return [&fn, callArgs = ArgsBuilder<A...>::makeArgs(std::forward<A>(args)...)]
+    {
+        return runtime::FunctionCaller(fn).call(callArgs);
+    };
+}
+
+inline std::future<Value> submitCall(parallel::Executor& executor, BoundCall call)
+{
+    auto promise = std::make_shared<std::promise<Value>>();
+    std::future<Value> result = promise->get_future();
+    executor.submit([promise, call = std::move(call)]
+    {
+#if PONDER_EXCEPTIONS
+        try
+        {
+            promise->set_value(call());
+        }
+        catch (...)
+        {
+            promise->set_exception(std::current_exception());
+        }
+#else
+        promise->set_value(call());
+#endif
+    });
+    return result;
+}
+
+} // namespace detail
+
+/**
+ * \brief Call a member function asynchronously
+ *
+ * The arguments are packed into Args on the calling thread, then the call is run by the
+ * executor, like call() would. The function and the object must outlive the call.
+ *
+ * \note A task of a parallel::ThreadPool waiting for a call on the same pool must use
+ *       parallel::ThreadPool::wait(), not std::future::get(), which can deadlock.
+ *
+ * \param executor Executor to run the call, e.g. a parallel::ThreadPool
+ * \param fn The Function to call
+ * \param obj Object to call the function on
+ * \param args Arguments for the function
+ * \return Future of the value returned, or of the error thrown by the call
+ *
+ * \code
+ * std::future<ponder::Value> result = runtime::callAsync(pool, fn, object, 3, "three");
+ * ...
+ * ponder::Value value = result.get();
+ * \endcode
+ *
+ * \sa call(), callStaticAsync()
+ */
+template <typename... A>
+inline std::future<Value> callAsync(parallel::Executor& executor, const Function& fn,
+                                    const UserObject& obj, A&&... args)
+{
+    return detail::submitCall(executor, detail::bindCall(fn, obj, std::forward<A>(args)...));
+}
+
+/**
+ * \brief Call a member function asynchronously, on the default thread pool
+ *
+ * \see callAsync(parallel::Executor&, const Function&, const UserObject&, A&&...)
+ */
+template <typename... A>
+inline std::future<Value> callAsync(const Function& fn, const UserObject& obj, A&&... args)
+{
+    return callAsync(parallel::ThreadPool::defaultPool(), fn, obj, std::forward<A>(args)...);
+}
+
+/**
+ * \brief Call a non-member function asynchronously
+ *
+ * \param executor Executor to run the call, e.g. a parallel::ThreadPool
+ * \param fn The Function to call
+ * \param args Arguments for the function
+ * \return Future of the value returned, or of the error thrown by the call
+ *
+ * \sa callStatic(), callAsync()
+ */
+template <typename... A>
+inline std::future<Value> callStaticAsync(parallel::Executor& executor, const Function& fn,
+                                          A&&... args)
+{
+    return detail::submitCall(executor, detail::bindStaticCall(fn, std::forward<A>(args)...));
+}
+
+/**
+ * \brief Call a non-member function asynchronously, on the default thread pool
+ *
+ * \see callStaticAsync(parallel::Executor&, const Function&, A&&...)
+ */
+template <typename... A>
+inline std::future<Value> callStaticAsync(const Function& fn, A&&... args)
+{
+    return callStaticAsync(parallel::ThreadPool::defaultPool(), fn, std::forward<A>(args)...);
+}
+
+#ifdef PONDER_USES_ASYNC_COROUTINES
+
+/**
+ * \brief Awaitable reflected call, for C++20 coroutines
+ *
+ * The awaiting coroutine is suspended, the call is run by the executor, and the coroutine
+ * is resumed on the executor's thread with the value returned, or the error thrown.
+ *
+ * \code
+ * ponder::Value value = co_await runtime::awaitCall(pool, fn, object, 3);
+ * \endcode
+ *
+ * \sa awaitCall(), awaitStaticCall()
+ */
+class CallAwaiter
+{
+public:
+
+    CallAwaiter(parallel::Executor& executor, detail::BoundCall call)
+        :   m_executor(executor)
+        ,   m_call(std::move(call))
+    {}
+
+    bool await_ready() const noexcept {return false;}
+
+    void await_suspend(std::coroutine_handle<> handle)
+    {
+        m_executor.submit([this, handle]
+        {
+#if PONDER_EXCEPTIONS
+            try
+            {
+                m_result = m_call();
+            }
+            catch (...)
+            {
+                m_error = std::current_exception();
+            }
+#else
+            m_result = m_call();
+#endif
+            handle.resume();
+        });
+    }
+
+    Value await_resume()
+    {
+        if (m_error)
+            std::rethrow_exception(m_error);
+        return std::move(m_result);
+    }
+
+private:
+
+    parallel::Executor& m_executor;
+    detail::BoundCall m_call;
+    Value m_result;
+    std::exception_ptr m_error;
+};
+
+/**
+ * \brief Call a member function from a coroutine
+ *
+ * \see CallAwaiter, callAsync()
+ */
+template <typename... A>
+inline CallAwaiter awaitCall(parallel::Executor& executor, const Function& fn,
+                             const UserObject& obj, A&&... args)
+{
+    return CallAwaiter(executor, detail::bindCall(fn, obj, std::forward<A>(args)...));
+}
+
+/**
+ * \brief Call a non-member function from a coroutine
+ *
+ * \see CallAwaiter, callStaticAsync()
+ */
+template <typename... A>
+inline CallAwaiter awaitStaticCall(parallel::Executor& executor, const Function& fn,
+                                   A&&... args)
+{
+    return CallAwaiter(executor, detail::bindStaticCall(fn, std::forward<A>(args)...));
+}
+
+#endif // PONDER_USES_ASYNC_COROUTINES
+
+} // namespace runtime
+} // namespace ponder
+
+#endif // PONDER_USES_ASYNC_HPP
@@ -39,6 +39,8 @@ extern "C" {
 #include <lauxlib.h>
 }
 
+#include <ponder/profiling.hpp>
+
 // forward declare
 namespace ponder { namespace lua {
     int pushUserObject(lua_State *L, const ponder::UserObject& uobj);
@@ -439,7 +441,13 @@ public:
         lua_pushlightuserdata(L, (void*) this);
         lua_pushcclosure(L, m_luaFunc, 1);
     }
-    
+
+    // Set the statistics of the calls, recorded when PONDER_PROFILING is on.
+    void setProfile(const profiling::detail::CallProfile* profile) { m_profile = profile; }
+
+protected:
+    const profiling::detail::CallProfile* m_profile = nullptr;
+
 private:
     const IdRef m_name;
     int (*m_luaFunc)(lua_State*);
@@ -472,6 +480,9 @@ private:
         ThisType *self = reinterpret_cast<ThisType*>(lua_touserdata(L, -1));
         lua_pop(L, 1);
 
+#if PONDER_PROFILING
+        profiling::detail::CallTimer timer(self->m_profile);
+#endif
         return DispatchType::template
             call<decltype(m_function), FTraits, FPolicies>(self->m_function, L);
     }
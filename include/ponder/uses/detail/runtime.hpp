@@ -32,6 +32,7 @@
 
 #include <ponder/detail/rawtype.hpp>
 #include <ponder/detail/util.hpp>
+#include <ponder/profiling.hpp>
 
 namespace ponder {
 namespace runtime {
@@ -116,7 +117,7 @@ struct ChooseCallReturner<std::tuple<P, Ps...>, R> // recurse
  * Helper function which converts an argument to a C++ type
  *
  * The main purpose of this function is to convert any BadType error to
- * a BadArgument one.
+ * a BadArgument one. isConvertible() checks the conversion without throwing.
  */
 template <int TFrom, typename TTo>
 struct ConvertArg
@@ -125,15 +126,35 @@ struct ConvertArg
     static ReturnType
     convert(const Args& args, size_t index)
     {
+#if PONDER_EXCEPTIONS
         try {
             return args[index].to<typename std::remove_reference<TTo>::type>();
         }
         catch (const BadType&) {
             PONDER_ERROR(BadArgument(args[index].kind(), mapType<TTo>(), index, "?"));
         }
+#else
+        if (!isConvertible(args, index))
+            PONDER_ERROR(BadArgument(args[index].kind(), mapType<TTo>(), index, "?"));
+        return args[index].to<typename std::remove_reference<TTo>::type>();
+#endif
+    }
+
+    static bool isConvertible(const Args& args, size_t index)
+    {
+        return args[index].isCompatible<typename std::remove_reference<TTo>::type>();
     }
 };
 
+// Check that an argument holds a non-null object which can be referenced as a TTo.
+template <typename TTo>
+bool isUserRefConvertible(const Value& arg)
+{
+    if (arg.kind() != ValueKind::User)
+        return false;
+    return arg.cref<UserObject>().checkGet<TTo>() == ErrorCode::None;
+}
+
 // Specialisation for returning references.
 template <typename TTo>
 struct ConvertArg<(int)ValueKind::User, TTo&>
@@ -142,10 +163,17 @@ struct ConvertArg<(int)ValueKind::User, TTo&>
     static ReturnType
     convert(const Args& args, size_t index)
     {
-        auto&& uobj = const_cast<Value&>(args[index]).ref<UserObject>();
+        // Not ref(), which would copy a shared copy on write object in the Args, and the
+        // write would be lost. The called object is passed by writableRef().
+        auto&& uobj = args[index].cref<UserObject>();
         if (uobj.pointer() == nullptr)
             PONDER_ERROR(NullObject(&uobj.getClass()));
-        return uobj.ref<TTo>();
+        return const_cast<TTo&>(uobj.cref<TTo>());
+    }
+
+    static bool isConvertible(const Args& args, size_t index)
+    {
+        return isUserRefConvertible<TTo>(args[index]);
     }
 };
 
@@ -162,6 +190,11 @@ struct ConvertArg<(int)ValueKind::User, const TTo&>
             PONDER_ERROR(NullObject(&uobj.getClass()));
         return uobj.cref<TTo>();
     }
+
+    static bool isConvertible(const Args& args, size_t index)
+    {
+        return isUserRefConvertible<TTo>(args[index]);
+    }
 };
 
 //-----------------------------------------------------------------------------
@@ -178,6 +211,11 @@ struct ConvertArgs
     {
         return Convertor::convert(args, index);
     }
+
+    static bool isConvertible(const Args& args, size_t index)
+    {
+        return Convertor::isConvertible(args, index);
+    }
 };
 
 template <typename R, typename FTraits, typename FPolicies>
@@ -186,10 +224,10 @@ class CallHelper
 public:
 
     template<typename F, typename... A, size_t... Is>
-    static Value call(F func, const Args& args, PONDER__SEQNS::index_sequence<Is...>)
+    static Value call(const F& func, const Args& args, PONDER__SEQNS::index_sequence<Is...>)
     {
         typedef typename ChooseCallReturner<FPolicies, R>::type CallReturner;
-        return CallReturner::value(func(ConvertArgs<A>::convert(args, Is)...));
+        return CallReturner::value(std::invoke(func, ConvertArgs<A>::convert(args, Is)...));
     }
 };
 
@@ -200,9 +238,9 @@ class CallHelper<void, FTraits, FPolicies>
 public:
 
     template<typename F, typename... A, size_t... Is>
-    static Value call(F func, const Args& args, PONDER__SEQNS::index_sequence<Is...>)
+    static Value call(const F& func, const Args& args, PONDER__SEQNS::index_sequence<Is...>)
     {
-        func(ConvertArgs<A>::convert(args,Is)...);
+        std::invoke(func, ConvertArgs<A>::convert(args,Is)...);
         return Value::nothing;
     }
 };
@@ -217,12 +255,26 @@ template <typename R, typename... A> struct FunctionWrapper<R, std::tuple<A...>>
     typedef typename std::function<R(A...)> Type;
     
     template <typename F, typename FTraits, typename FPolicies>
-    static Value call(F func, const Args& args)
+    static Value call(const F& func, const Args& args)
     {
         typedef PONDER__SEQNS::make_index_sequence<sizeof...(A)> ArgEnumerator;
         return CallHelper<R, FTraits, FPolicies>::template
             call<F, A...>(func, args, ArgEnumerator());
     }
+
+    // Check that all the arguments can be converted, without throwing.
+    static bool checkArgs(const Args& args)
+    {
+        return checkArgs(args, PONDER__SEQNS::make_index_sequence<sizeof...(A)>());
+    }
+
+private:
+
+    template <size_t... Is>
+    static bool checkArgs(const Args& args, PONDER__SEQNS::index_sequence<Is...>)
+    {
+        return args.count() >= sizeof...(A) && (ConvertArgs<A>::isConvertible(args, Is) && ...);
+    }
 };
     
 //-----------------------------------------------------------------------------
@@ -239,13 +291,39 @@ public:
     const IdRef name() const { return m_name; }
     
     virtual Value execute(const Args& args) const = 0;
+
+    // Check that execute() can convert the arguments, without throwing.
+    virtual bool checkArgs(const Args& args) const = 0;
+
+    // Function pointer to a native call thunk, see typedCall().
+    typedef void (*TypedThunk)();
+
+    // Get the thunk calling the function with its native C++ signature,
+    // R(*)(const FunctionCaller&, A...), or null if signature isn't R(A...).
+    virtual TypedThunk typedCall(TypeId signature) const = 0;
+
+    // Set the statistics of the calls, recorded when PONDER_PROFILING is on.
+    void setProfile(const profiling::detail::CallProfile* profile) { m_profile = profile; }
     
+protected:
+    const profiling::detail::CallProfile* m_profile = nullptr;
+
 private:
     const IdRef m_name;
 };
 
+// Native C++ signature of a function: R(A...)
+template <typename R, typename A> struct FunctionSignature;
+
+template <typename R, typename... A> struct FunctionSignature<R, std::tuple<A...>>
+{
+    typedef R Type(A...);
+};
+
 // The FunctionImpl class is a template which is specialized according to the
 // underlying function prototype.
+//  - The function is stored as declared (function pointer, member pointer, functor) and
+//    called directly from execute(), which is the only indirect call.
 template <typename F, typename FTraits, typename FPolicies>
 class FunctionCallerImpl final : public FunctionCaller
 {
@@ -261,12 +339,41 @@ private:
     typedef typename FTraits::Details::FunctionCallTypes CallTypes;
     typedef FunctionWrapper<typename FTraits::ExposedType, CallTypes> DispatchType;
     
-    typename DispatchType::Type m_function; // Object containing the actual function to call
+    F m_function; // The actual function to call
     
     Value execute(const Args& args) const final
     {
-        return DispatchType::template
-            call<decltype(m_function), FTraits, FPolicies>(m_function, args);
+#if PONDER_PROFILING
+        profiling::detail::CallTimer timer(m_profile);
+#endif
+        return DispatchType::template call<F, FTraits, FPolicies>(m_function, args);
+    }
+
+    bool checkArgs(const Args& args) const final
+    {
+        return DispatchType::checkArgs(args);
+    }
+
+    typedef typename FunctionSignature<typename FTraits::ExposedType, CallTypes>::Type Signature;
+
+    template <typename R, typename... A>
+    static R callNative(const FunctionCaller& self, A... args)
+    {
+        return std::invoke(static_cast<const FunctionCallerImpl&>(self).m_function,
+                           std::forward<A>(args)...);
+    }
+
+    template <typename R, typename... A>
+    static TypedThunk nativeThunk(R(*)(A...))
+    {
+        return reinterpret_cast<TypedThunk>(&callNative<R, A...>);
+    }
+
+    TypedThunk typedCall(TypeId signature) const final
+    {
+        if (signature != ponder::detail::calcTypeId<Signature>())
+            return nullptr;
+        return nativeThunk(static_cast<Signature*>(nullptr));
     }
 };
 
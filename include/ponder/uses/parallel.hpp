@@ -0,0 +1,136 @@
+/****************************************************************************
+**
+** This file is part of the Ponder library.
+**
+** The MIT License (MIT)
+**
+** Copyright (C) 2009-2014 TEGESO/TEGESOFT and/or its subsidiary(-ies) and mother company.
+** Copyright (C) 2015-2020 Nick Trout.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a copy
+** of this software and associated documentation files (the "Software"), to deal
+** in the Software without restriction, including without limitation the rights
+** to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+** copies of the Software, and to permit persons to whom the Software is
+** furnished to do so, subject to the following conditions:
+** 
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+** 
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+** OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+** THE SOFTWARE.
+**
+****************************************************************************/
+
+/**
+ * \file
+ * \brief Parallel uses for Ponder registered data.
+ */
+
+#pragma once
+#ifndef PONDER_USES_PARALLEL_HPP
+#define PONDER_USES_PARALLEL_HPP
+
+#include <ponder/threadpool.hpp>
+#include <ponder/uses/runtime.hpp>
+
+namespace ponder {
+namespace parallel {
+
+/**
+ * \brief Minimum number of objects handled by a task in forEach()
+ */
+static constexpr size_t forEachGrain = 64;
+
+/**
+ * \brief Call a member function on each object of a range, in parallel
+ *
+ * The range is split into shards which are run by the pool, see ThreadPool::forRange().
+ * Each shard calls runtime::ObjectCaller::callBatch() with its own copy of the arguments,
+ * so no argument list is shared between threads.
+ *
+ * \note The metaclasses are read but not modified during the calls: no class may be
+ *       declared or undeclared meanwhile. The objects must be distinct, and the function
+ *       safe to call on distinct objects at the same time.
+ *
+ * \param pool Pool to run the calls
+ * \param objects Objects to call the function on
+ * \param count Number of objects
+ * \param function The Function to call
+ * \param args Arguments to pass to each call
+ * \param results If not null, receives the count values returned by the calls
+ *
+ * \code
+ * ponder::parallel::forEach(entities.data(), entities.size(),
+ *                           metaclass.function("update"), ponder::Args(deltaTime));
+ * \endcode
+ *
+ * \throw The first error thrown by a call, see runtime::ObjectCaller::callBatch().
+ *        Objects of the shards not yet started are then not called.
+ */
+inline void forEach(ThreadPool& pool, const UserObject* objects, size_t count,
+                    const Function& function, const Args& args = Args::empty,
+                    Value* results = nullptr)
+{
+    pool.forRange(count, forEachGrain, [&](size_t begin, size_t end)
+    {
+        runtime::ObjectCaller caller(function);
+        caller.callBatch(objects + begin, end - begin, args, results ? results + begin : nullptr);
+    });
+}
+
+/**
+ * \brief Call a member function on each object of a range, in parallel, using the default pool
+ *
+ * \see forEach(ThreadPool&, const UserObject*, size_t, const Function&, const Args&, Value*)
+ */
+inline void forEach(const UserObject* objects, size_t count, const Function& function,
+                    const Args& args = Args::empty, Value* results = nullptr)
+{
+    forEach(ThreadPool::defaultPool(), objects, count, function, args, results);
+}
+
+/**
+ * \brief Set a property of each object of a range, in parallel
+ *
+ * \note See the notes of forEach() for functions.
+ *
+ * \param pool Pool to run the updates
+ * \param objects Objects to modify
+ * \param count Number of objects
+ * \param property The Property to set
+ * \param value Value to set
+ *
+ * \throw The first error thrown by Property::set().
+ */
+inline void forEach(ThreadPool& pool, const UserObject* objects, size_t count,
+                    const Property& property, const Value& value)
+{
+    pool.forRange(count, forEachGrain, [&](size_t begin, size_t end)
+    {
+        const Value shardValue(value); // Not shared between threads
+        for (size_t i = begin; i < end; ++i)
+            property.set(objects[i], shardValue);
+    });
+}
+
+/**
+ * \brief Set a property of each object of a range, in parallel, using the default pool
+ *
+ * \see forEach(ThreadPool&, const UserObject*, size_t, const Property&, const Value&)
+ */
+inline void forEach(const UserObject* objects, size_t count, const Property& property,
+                    const Value& value)
+{
+    forEach(ThreadPool::defaultPool(), objects, count, property, value);
+}
+
+} // namespace parallel
+} // namespace ponder
+
+#endif // PONDER_USES_PARALLEL_HPP
@@ -128,6 +128,18 @@ public:
      */
     UserObject construct(const Args& args = Args::empty, void* ptr = nullptr) const;
 
+    /**
+     * \brief Construct a new instance of the C++ class bound to the metaclass, without throwing
+     *
+     * As construct(), but a failure to find a matching constructor is returned as an error.
+     *
+     * \param args Arguments to pass to the constructor (empty by default)
+     * \param ptr Optional pointer to the location to construct the object (placement new)
+     * \return New instance wrapped into a UserObject, or ErrorCode::ConstructorNotFound
+     * \sa construct()
+     */
+    Expected<UserObject> tryConstruct(const Args& args = Args::empty, void* ptr = nullptr) const;
+
     /**
      * \brief Create a new instance of the class bound to the metaclass
      *
@@ -218,6 +230,62 @@ public:
      */
     template <typename... A>
     Value call(const UserObject &obj, A&&... args);
+
+    /**
+     * \brief Call the function, without throwing
+     *
+     * The object and the arguments are checked before the call and a mismatch is returned
+     * as an error. Errors raised by the called function itself are not caught.
+     *
+     * \param obj Object
+     * \param args Arguments to pass to the function
+     *
+     * \return Value returned by the function call, or ErrorCode::NullObject,
+     *         ErrorCode::NotEnoughArguments or ErrorCode::BadArgument
+     *
+     * \sa call()
+     */
+    template <typename... A>
+    Expected<Value> tryCall(const UserObject &obj, A&&... args);
+
+    /**
+     * \brief Call the function on a batch of objects, with the same arguments
+     *
+     * The argument count is checked once for the batch. The arguments are copied once,
+     * only the object is replaced for each call.
+     *
+     * \param objects Objects to call the function on
+     * \param count Number of objects
+     * \param args Arguments to pass to each call
+     * \param results If not null, receives the count values returned by the calls
+     *
+     * \throw ForbiddenCall the function is not callable
+     * \throw NullObject one of the objects is invalid
+     * \throw NotEnoughArguments too few arguments are provided
+     * \throw BadArgument one of the arguments can't be converted to the requested type
+     *
+     * \note If a call throws, the following calls are not made.
+     */
+    void callBatch(const UserObject* objects, size_t count, const Args& args,
+                   Value* results = nullptr);
+
+    /**
+     * \brief Call the function on a batch of objects, with arguments for each object
+     *
+     * \param objects Objects to call the function on
+     * \param count Number of objects
+     * \param args Arguments to pass to each call, count lists
+     * \param results If not null, receives the count values returned by the calls
+     *
+     * \throw ForbiddenCall the function is not callable
+     * \throw NullObject one of the objects is invalid
+     * \throw NotEnoughArguments too few arguments are provided
+     * \throw BadArgument one of the arguments can't be converted to the requested type
+     *
+     * \note If a call throws, the following calls are not made.
+     */
+    void callBatch(const UserObject* objects, size_t count, const Args* args,
+                   Value* results = nullptr);
     
 private:
     
@@ -267,6 +335,22 @@ public:
      */
     template <typename... A>
     Value call(A... args);
+
+    /**
+     * \brief Call the static function, without throwing
+     *
+     * The arguments are checked before the call and a mismatch is returned as an error.
+     * Errors raised by the called function itself are not caught.
+     *
+     * \param args Arguments to pass to the function
+     *
+     * \return Value returned by the function call, or ErrorCode::NotEnoughArguments or
+     *         ErrorCode::BadArgument
+     *
+     * \sa call()
+     */
+    template <typename... A>
+    Expected<Value> tryCall(A... args);
     
 private:
     
@@ -274,6 +358,77 @@ private:
     runtime::detail::FunctionCaller *m_caller;
 };
 
+/**
+ * \brief This object is used to invoke a function with its native C++ signature
+ *
+ * A TypedCaller is bound to a function once, and checks then that R(A...) is exactly the
+ * C++ signature of the function. It is then called with C++ arguments and returns the C++
+ * result: the arguments are not packed into Args and the result is not wrapped in a Value.
+ * For member functions the first argument is the object, e.g. `int(MyClass&, int)`.
+ *
+ * \code
+ * runtime::TypedCaller<int(MyClass&, int)> add(classByType<MyClass>().function("add"));
+ * int total = add(object, 3);
+ * \endcode
+ *
+ * \sa ObjectCaller, FunctionCaller
+ */
+template <typename S> class TypedCaller;
+
+template <typename R, typename... A>
+class TypedCaller<R(A...)>
+{
+public:
+
+    /**
+     * \brief Constructor
+     *
+     * \param f The function to call
+     *
+     * \throw BadArgument a parameter type doesn't match the function's
+     * \throw BadType the return type doesn't match the function's
+     * \throw BadSignature R(A...) isn't the signature of the function
+     */
+    TypedCaller(const Function& f);
+
+    /**
+     * \brief Get the function being used
+     *
+     * \return a Function reference
+     */
+    const Function& function() const { return *m_func; }
+
+    /**
+     * \brief Call the function
+     *
+     * \param args Arguments to pass to the function
+     *
+     * \return Value returned by the function call
+     */
+    R call(A... args) const
+    {
+        return m_thunk(*m_caller, std::forward<A>(args)...);
+    }
+
+    /**
+     * \brief Call the function
+     *
+     * \see call()
+     */
+    R operator () (A... args) const
+    {
+        return m_thunk(*m_caller, std::forward<A>(args)...);
+    }
+
+private:
+
+    typedef R (*Thunk)(const runtime::detail::FunctionCaller&, A...);
+
+    const Function* m_func;
+    const runtime::detail::FunctionCaller* m_caller;
+    Thunk m_thunk;
+};
+
 //--------------------------------------------------------------------------------------
 // Helpers
     
@@ -296,6 +451,24 @@ static inline UserObject create(const Class &cls, A... args)
     return ObjectFactory(cls).create(args...);
 }
 
+/**
+ * \brief Create instance of metaclass as a UserObject, without throwing
+ *
+ * This is a helper function which uses ObjectFactory::tryConstruct().
+ *
+ * \param cls The metaclass to make an instance of
+ * \param args The constructor arguments for the class instance
+ * \return A UserObject which owns an instance of the metaclass, or
+ *         ErrorCode::ConstructorNotFound
+ *
+ * \sa create()
+ */
+template <typename... A>
+static inline Expected<UserObject> tryCreate(const Class &cls, A... args)
+{
+    return ObjectFactory(cls).tryConstruct(Args(args...));
+}
+
 typedef std::unique_ptr<UserObject> UniquePtr;
 
 inline UniquePtr makeUniquePtr(UserObject *obj)
@@ -344,6 +517,76 @@ static inline Value call(const Function &fn, const UserObject &obj, A&&... args)
                                  detail::ArgsBuilder<A...>::makeArgs(std::forward<A>(args)...));
 }
 
+/**
+ * \brief Call a member function, without throwing
+ *
+ * This is a helper function which uses ObjectCaller::tryCall().
+ *
+ * \param fn The Function to call
+ * \param obj Object to call the function on
+ * \param args Arguments for the function
+ * \return The return value, or the code of the error
+ *
+ * \code
+ * auto result = runtime::tryCall(metaclass.function("add"), object, 1, 2);
+ * if (!result)
+ *     log(result.error());
+ * \endcode
+ *
+ * \sa call()
+ */
+template <typename... A>
+static inline Expected<Value> tryCall(const Function &fn, const UserObject &obj, A&&... args)
+{
+    return ObjectCaller(fn).tryCall(obj,
+                                    detail::ArgsBuilder<A...>::makeArgs(std::forward<A>(args)...));
+}
+
+/**
+ * \brief Call a member function on a batch of objects, with the same arguments
+ *
+ * This is a helper function which uses ObjectCaller::callBatch(). The function is
+ * resolved once for the batch, rather than once per call as with call().
+ *
+ * \param fn The Function to call
+ * \param objects Objects to call the function on
+ * \param count Number of objects
+ * \param args Arguments to pass to each call
+ * \param results If not null, receives the count values returned by the calls
+ *
+ * \code
+ * std::vector<ponder::UserObject> entities = ...;
+ * runtime::callBatch(metaclass.function("update"), entities.data(), entities.size(),
+ *                    ponder::Args(deltaTime));
+ * \endcode
+ *
+ * \sa call()
+ */
+static inline void callBatch(const Function &fn, const UserObject* objects, size_t count,
+                             const Args& args, Value* results = nullptr)
+{
+    ObjectCaller(fn).callBatch(objects, count, args, results);
+}
+
+/**
+ * \brief Call a member function on a batch of objects, with arguments for each object
+ *
+ * This is a helper function which uses ObjectCaller::callBatch().
+ *
+ * \param fn The Function to call
+ * \param objects Objects to call the function on
+ * \param count Number of objects
+ * \param args Arguments to pass to each call, count lists
+ * \param results If not null, receives the count values returned by the calls
+ *
+ * \sa call()
+ */
+static inline void callBatch(const Function &fn, const UserObject* objects, size_t count,
+                             const Args* args, Value* results = nullptr)
+{
+    ObjectCaller(fn).callBatch(objects, count, args, results);
+}
+
 /**
  * \brief Call a non-member function
  *
@@ -361,6 +604,24 @@ static inline Value callStatic(const Function &fn, A&&... args)
     return FunctionCaller(fn).call(detail::ArgsBuilder<A...>::makeArgs(std::forward<A>(args)...));
 }
 
+/**
+ * \brief Call a non-member function, without throwing
+ *
+ * This is a helper function which uses FunctionCaller::tryCall().
+ *
+ * \param fn The Function to call
+ * \param args Arguments for the function
+ * \return The return value, or the code of the error
+ *
+ * \sa callStatic()
+ */
+template <typename... A>
+static inline Expected<Value> tryCallStatic(const Function &fn, A&&... args)
+{
+    return FunctionCaller(fn).tryCall(
+        detail::ArgsBuilder<A...>::makeArgs(std::forward<A>(args)...));
+}
+
 } // namespace runtime
 } // namespace ponder
 
@@ -389,15 +650,63 @@ inline Value ObjectCaller::call(const UserObject &obj, A&&... vargs)
     if (args.count() < m_func.paramCount())
         PONDER_ERROR(NotEnoughArguments(m_func.name(), args.count(), m_func.paramCount()));
 
-    args.insert(0, obj);
+    // Pass a reference, so a copy on write object is written and not a copy of it
+    args.insert(0, obj.writableRef());
+
+    return m_caller->execute(args);
+}
+
+template <typename... A>
+inline Expected<Value> ObjectCaller::tryCall(const UserObject &obj, A&&... vargs)
+{
+    if (obj.pointer() == nullptr)
+        return ErrorCode::NullObject;
+
+    Args args(detail::ArgsBuilder<A...>::makeArgs(std::forward<A>(vargs)...));
+
+    if (args.count() < m_func.paramCount())
+        return ErrorCode::NotEnoughArguments;
+
+    args.insert(0, obj.writableRef());
+
+    if (!m_caller->checkArgs(args))
+        return ErrorCode::BadArgument;
 
     return m_caller->execute(args);
 }
     
+template <typename R, typename... A>
+TypedCaller<R(A...)>::TypedCaller(const Function& f)
+    :   m_func(&f)
+    ,   m_caller(std::get<uses::Uses::eRuntimeModule>(
+                 *reinterpret_cast<const uses::Uses::PerFunctionUserData*>(f.getUsesData())))
+    ,   m_thunk(nullptr)
+{
+    // Member functions take the object as first argument
+    const size_t first = f.kind() == FunctionKind::MemberFunction ? 1 : 0;
+    if (sizeof...(A) != f.paramCount() + first)
+        PONDER_ERROR(BadSignature(f.name(), sizeof...(A)));
+
+    // Check the kinds first, for a precise error
+    const ValueKind kinds[] = {mapType<A>()..., ValueKind::None};
+    for (size_t i = 0; i < f.paramCount(); ++i)
+    {
+        if (kinds[first + i] != f.paramType(i))
+            PONDER_ERROR(BadArgument(kinds[first + i], f.paramType(i), i, f.name()));
+    }
+
+    if (mapType<R>() != f.returnType())
+        PONDER_ERROR(BadType(mapType<R>(), f.returnType()));
+
+    m_thunk = reinterpret_cast<Thunk>(m_caller->typedCall(ponder::detail::calcTypeId<R(A...)>()));
+    if (!m_thunk)
+        PONDER_ERROR(BadSignature(f.name(), sizeof...(A)));
+}
+
 template <typename... A>
 inline Value FunctionCaller::call(A... vargs)
 {
-    Args args(detail::ArgsBuilder<A...>::makeArgs(vargs...));
+    Args args(detail::ArgsBuilder<A...>::makeArgs(std::forward<A>(vargs)...));
     
     // Check the number of arguments
     if (args.count() < m_func.paramCount())
@@ -406,6 +715,20 @@ inline Value FunctionCaller::call(A... vargs)
     return m_caller->execute(args);
 }
 
+template <typename... A>
+inline Expected<Value> FunctionCaller::tryCall(A... vargs)
+{
+    Args args(detail::ArgsBuilder<A...>::makeArgs(std::forward<A>(vargs)...));
+
+    if (args.count() < m_func.paramCount())
+        return ErrorCode::NotEnoughArguments;
+
+    if (!m_caller->checkArgs(args))
+        return ErrorCode::BadArgument;
+
+    return m_caller->execute(args);
+}
+
 } // namespace runtime
 } // namespace ponder
 
@@ -419,19 +742,25 @@ namespace runtime {
     
 UserObject ObjectFactory::construct(const Args& args, void* ptr) const
 {
-    // Search an arguments match among the list of available constructors
-    for (size_t nb = m_class.constructorCount(), i = 0; i < nb; ++i)
+    // Search an arguments match among the constructors, cached by signature
+    const Constructor* constructor = m_class.findConstructor(args);
+    if (constructor)
     {
-        const Constructor& constructor = *m_class.constructor(i);
-        if (constructor.matches(args))
-        {
-            // Match found: use the constructor to create the new instance
-            return constructor.create(ptr, args);
-        }
+        // Match found: use the constructor to create the new instance
+        return constructor->create(ptr, args);
     }
     
     return UserObject::nothing;  // no match found
 }
+
+Expected<UserObject> ObjectFactory::tryConstruct(const Args& args, void* ptr) const
+{
+    const Constructor* constructor = m_class.findConstructor(args);
+    if (!constructor)
+        return ErrorCode::ConstructorNotFound;
+
+    return constructor->create(ptr, args);
+}
     
 void ObjectFactory::destroy(const UserObject& object) const
 {
@@ -454,6 +783,53 @@ ObjectCaller::ObjectCaller(const Function &f)
 {
 }
 
+void ObjectCaller::callBatch(const UserObject* objects, size_t count, const Args& args,
+                             Value* results)
+{
+    // Check the number of arguments
+    if (args.count() < m_func.paramCount())
+        PONDER_ERROR(NotEnoughArguments(m_func.name(), args.count(), m_func.paramCount()));
+
+    // Copy the arguments once, only the object changes
+    Args callArgs(args);
+    callArgs.insert(0, Value::nothing);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const UserObject& obj = objects[i];
+        if (obj.pointer() == nullptr)
+            PONDER_ERROR(NullObject(&obj.getClass()));
+
+        callArgs.set(0, obj.writableRef());
+        Value result = m_caller->execute(callArgs);
+        if (results)
+            results[i] = std::move(result);
+    }
+}
+
+void ObjectCaller::callBatch(const UserObject* objects, size_t count, const Args* args,
+                             Value* results)
+{
+    Args callArgs;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const UserObject& obj = objects[i];
+        if (obj.pointer() == nullptr)
+            PONDER_ERROR(NullObject(&obj.getClass()));
+
+        // Check the number of arguments
+        if (args[i].count() < m_func.paramCount())
+            PONDER_ERROR(NotEnoughArguments(m_func.name(), args[i].count(), m_func.paramCount()));
+
+        callArgs = args[i];
+        callArgs.insert(0, obj.writableRef());
+        Value result = m_caller->execute(callArgs);
+        if (results)
+            results[i] = std::move(result);
+    }
+}
+
 FunctionCaller::FunctionCaller(const Function &f)
     :   m_func(f)
     ,   m_caller(std::get<uses::Uses::eRuntimeModule>(
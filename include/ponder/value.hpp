@@ -33,6 +33,7 @@
 
 #include <ponder/type.hpp>
 #include <ponder/enumobject.hpp>
+#include <ponder/expected.hpp>
 #include <ponder/userobject.hpp>
 #include <ponder/valuemapper.hpp>
 #include <ponder/detail/valueimpl.hpp>
@@ -106,6 +107,13 @@ public:
      * \param other Value to assign to this
      */
     void operator = (const Value& other);
+
+    /**
+     * \brief Move assignment operator
+     *
+     * \param other Value to move to this
+     */
+    void operator = (Value&& other);
     
     /**
      * \brief Return the Ponder runtime kind of the value
@@ -128,6 +136,22 @@ public:
     template <typename T>
     T to() const;
 
+    /**
+     * \brief Convert the value to the type T, without throwing
+     *
+     * \code
+     * if (ponder::Expected<int> count = value.tryTo<int>())
+     *     use(*count);
+     * \endcode
+     *
+     * \return Value converted to T, or ErrorCode::BadType if the stored value is not
+     *         convertible to T
+     *
+     * \sa to(), isCompatible()
+     */
+    template <typename T>
+    Expected<T> tryTo() const;
+
     /**
      * \brief Get a reference to the value data contained
      *
@@ -136,6 +160,8 @@ public:
      * convert the value.
      *
      * \return A non-const reference to the contained data.
+     *
+     * \throw BadType the stored value is not a T
      */
     template <typename T>
     T& ref();
@@ -148,6 +174,8 @@ public:
      * convert the value.
      *
      * \return A const reference to the contained data.
+     *
+     * \throw BadType the stored value is not a T
      */
     template <typename T>
     const T& cref() const;
@@ -156,6 +184,7 @@ public:
      * \brief Check if the stored value can be converted to a type T
      *
      * If this function returns true, then calling to<T>() or operator T() will succeed.
+     * It doesn't throw: the conversions which can fail are checked, not attempted.
      *
      * \return True if conversion is possible, false otherwise
      */
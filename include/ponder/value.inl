@@ -53,6 +53,7 @@ template <typename T, typename E = void>
 struct ValueTo
 {
     static T convert(const Value& value) {return value.visit(ConvertVisitor<T>());}
+    static bool isConvertible(const Value& value) {return value.visit(CompatibleVisitor<T>());}
 };
 
 // Don't need to convert, we're returning a Value
@@ -61,6 +62,7 @@ struct ValueTo<Value>
 {
     static Value convert(const Value& value) {return value;}
     static Value convert(Value&& value) {return std::move(value);}
+    static bool isConvertible(const Value&) {return true;}
 };
 
 // Convert Values to pointers for basic types
@@ -71,6 +73,7 @@ struct ValueTo<T*, typename std::enable_if<!hasStaticTypeDecl<T>()>::type>
     {
         return value.to<detail::ValueRef>().getRef<T>();
     }
+    static bool isConvertible(const Value& value) {return value.kind() == ValueKind::Reference;}
 };
 
 // Convert Values to references for basic types
@@ -95,6 +98,7 @@ Value::Value(const T& val)
 template <typename T>
 T Value::to() const
 {
+#if PONDER_EXCEPTIONS
     try
     {
         return detail::ValueTo<T>::convert(*this);
@@ -103,46 +107,41 @@ T Value::to() const
     {
         PONDER_ERROR(BadType(kind(), mapType<T>()));
     }
+#else
+    if (!isCompatible<T>())
+        PONDER_ERROR(BadType(kind(), mapType<T>()));
+    return detail::ValueTo<T>::convert(*this);
+#endif
+}
+
+template <typename T>
+Expected<T> Value::tryTo() const
+{
+    if (!isCompatible<T>())
+        return ErrorCode::BadType;
+    return detail::ValueTo<T>::convert(*this);
 }
 
 template <typename T>
 T& Value::ref()
 {
-    try
-    {
-        return m_value.get<T>();
-    }
-    catch (detail::bad_conversion&)
-    {
+    if (!m_value.is<T>())
         PONDER_ERROR(BadType(kind(), mapType<T>()));
-    }
+    return m_value.get_unchecked<T>();
 }
 
 template <typename T>
 const T& Value::cref() const
 {
-    try
-    {
-        return m_value.get<T>();
-    }
-    catch (detail::bad_conversion&)
-    {
+    if (!m_value.is<T>())
         PONDER_ERROR(BadType(kind(), mapType<T>()));
-    }
+    return m_value.get_unchecked<T>();
 }
 
 template <typename T>
 bool Value::isCompatible() const
 {
-    try
-    {
-        to<T>();
-        return true;
-    }
-    catch (std::exception&)
-    {
-        return false;
-    }
+    return detail::ValueTo<T>::isConvertible(*this);
 }
 
 template <typename T>
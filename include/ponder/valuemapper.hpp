@@ -38,6 +38,7 @@
 #include <ponder/arraymapper.hpp>
 #include <ponder/errors.hpp>
 #include <ponder/detail/util.hpp>
+#include <ponder/detail/internedid.hpp>
 #include <ponder/detail/valueref.hpp>
 
 /**
@@ -127,6 +128,10 @@ namespace ponder_ext {
  * }
  * \endcode
  *
+ * A mapper may also declare `static bool isConvertible(const U& source)` for the source types
+ * whose conversion can fail. Value::isCompatible() and Value::tryTo() call it rather than
+ * catch the error raised by from(), which also makes them work without exceptions.
+ *
  * Generic version of ValueMapper -- T doesn't match with any specialization
  * and is thus treated as a user object    
  */
@@ -154,6 +159,11 @@ struct ValueMapper
         {PONDER_ERROR(ponder::BadType(ponder::ValueKind::Reference, ponder::mapType<T>()));}
     static T from(const ponder::UserObject& source)
         {return source.get<T>();}
+
+    template <typename U>
+    static bool isConvertible(const U&) {return false;}
+    static bool isConvertible(const ponder::UserObject& source)
+        {return source.checkGet<T>() == ponder::ErrorCode::None;}
 };
 
 /**
@@ -192,6 +202,10 @@ struct ValueMapper<T*, typename std::enable_if<!ponder::detail::hasStaticTypeDec
         {PONDER_ERROR(ponder::BadType(ponder::ValueKind::Enum,   ponder::mapType<T>()));}
     static T from(const ponder::UserObject&)
         {PONDER_ERROR(ponder::BadType(ponder::ValueKind::User,   ponder::mapType<T>()));}
+
+    template <typename U>
+    static bool isConvertible(const U&) {return false;}
+    static bool isConvertible(const ponder::detail::ValueRef&) {return true;}
 };
 
 ///**
@@ -236,6 +250,11 @@ struct ValueMapper<bool>
     static bool from(const ponder::EnumObject& source) {return source.value() != 0;}
     static bool from(const ponder::UserObject& source) {return source.pointer() != nullptr;}
     static bool from(const ponder::detail::ValueRef& source) {return source.getRef<bool>();}
+
+    template <typename U>
+    static bool isConvertible(const U&) {return true;}
+    static bool isConvertible(const ponder::String& source)
+        {return ponder::detail::canConvert<bool>(source);}
 };
 
 /**
@@ -259,6 +278,12 @@ struct ValueMapper<T,
     static T from(const ponder::UserObject&)
         {PONDER_ERROR(ponder::BadType(ponder::ValueKind::User, ponder::ValueKind::Integer));}
     static T from(const ponder::detail::ValueRef& source) {return *source.getRef<T>();}
+
+    template <typename U>
+    static bool isConvertible(const U&) {return true;}
+    static bool isConvertible(const ponder::String& source)
+        {return ponder::detail::canConvert<T>(source);}
+    static bool isConvertible(const ponder::UserObject&) {return false;}
 };
 
 /*
@@ -282,6 +307,12 @@ struct ValueMapper<T,
     static T from(const ponder::UserObject&)
         {PONDER_ERROR(ponder::BadType(ponder::ValueKind::User, ponder::ValueKind::Real));}
     static T from(const ponder::detail::ValueRef& source) {return *source.getRef<T>();}
+
+    template <typename U>
+    static bool isConvertible(const U&) {return true;}
+    static bool isConvertible(const ponder::String& source)
+        {return ponder::detail::canConvert<T>(source);}
+    static bool isConvertible(const ponder::UserObject&) {return false;}
 };
 
 /**
@@ -307,6 +338,11 @@ struct ValueMapper<ponder::String>
         {PONDER_ERROR(ponder::BadType(ponder::ValueKind::User, ponder::ValueKind::String));}
     static ponder::String from(const ponder::detail::ValueRef& source)
         {PONDER_ERROR(ponder::BadType(ponder::ValueKind::Reference, ponder::ValueKind::String));}
+
+    template <typename U>
+    static bool isConvertible(const U&) {return true;}
+    static bool isConvertible(const ponder::UserObject&) {return false;}
+    static bool isConvertible(const ponder::detail::ValueRef&) {return false;}
 };
 
 // TODO - Add ponder::is_string() ?
@@ -323,8 +359,32 @@ struct ValueMapper<ponder::detail::string_view>
     template <typename T>
     static ponder::detail::string_view from(const T& source)
         {return ponder::detail::string_view(ValueMapper<ponder::String>::from(source));}
+    template <typename T>
+    static bool isConvertible(const T& source)
+        {return ValueMapper<ponder::String>::isConvertible(source);}
+};
+
+/**
+ * Specialization of ValueMapper for interned identifiers (see PONDER_ID_TRAITS_INTERNED)
+ */
+template <>
+struct ValueMapper<ponder::detail::InternedId>
+{
+    static constexpr ponder::ValueKind kind = ponder::ValueKind::String;
+
+    static const ponder::String& to(const ponder::detail::InternedId& id) {return id.str();}
+    template <typename T>
+    static ponder::detail::InternedId from(const T& source)
+        {return ponder::detail::InternedId(ValueMapper<ponder::String>::from(source));}
+    template <typename T>
+    static bool isConvertible(const T& source)
+        {return ValueMapper<ponder::String>::isConvertible(source);}
 };
 
+template <>
+struct ValueMapper<const ponder::detail::InternedId>
+    : ValueMapper<ponder::detail::InternedId> {};
+
 /**
  * Specialization of ValueMapper for const char*.
  * Conversions to const char* are disabled (can't return a pointer to a temporary)
@@ -342,6 +402,9 @@ struct ValueMapper<const char*>
         // a ponder::Value to a const char*, which is not allowed
         return T::CONVERSION_TO_CONST_CHAR_PTR_IS_NOT_ALLOWED();
     }
+
+    template <typename T>
+    static bool isConvertible(const T&) {return false;}
 };
 
 /**
@@ -416,6 +479,20 @@ struct ValueMapper<T, typename std::enable_if<std::is_enum<T>::value>::type>
         // Not a valid enum name or number: throw an error
         PONDER_ERROR(ponder::BadType(ponder::ValueKind::String, ponder::ValueKind::Enum));
     }
+
+    template <typename U>
+    static bool isConvertible(const U&) {return true;}
+    static bool isConvertible(const ponder::UserObject&) {return false;}
+    static bool isConvertible(const ponder::detail::ValueRef&) {return false;}
+    static bool isConvertible(const ponder::String& source)
+    {
+        const ponder::Enum* metaenum = ponder::enumByTypeSafe<T>();
+        if (metaenum && metaenum->hasName(source))
+            return true;
+
+        long value;
+        return ponder::detail::conv(source, value) && (!metaenum || metaenum->hasValue(value));
+    }
 };
 
 /**
@@ -440,6 +517,10 @@ struct ValueMapper<ponder::EnumObject>
         {PONDER_ERROR(ponder::BadType(ponder::ValueKind::Enum,   ponder::ValueKind::Enum));}
     static ponder::EnumObject from(const ponder::detail::ValueRef& source)
         {PONDER_ERROR(ponder::BadType(ponder::ValueKind::Reference, ponder::ValueKind::Enum));}
+
+    template <typename U>
+    static bool isConvertible(const U&) {return false;}
+    static bool isConvertible(const ponder::EnumObject&) {return true;}
 };
 
 /**
@@ -475,6 +556,10 @@ struct ValueMapper<ponder::UserObject>
         {PONDER_ERROR(ponder::BadType(ponder::ValueKind::Enum,   ponder::ValueKind::User));}
     static ponder::UserObject from(const ponder::detail::ValueRef& source)
         {PONDER_ERROR(ponder::BadType(ponder::ValueKind::Reference, ponder::ValueKind::User));}
+
+    template <typename U>
+    static bool isConvertible(const U&) {return false;}
+    static bool isConvertible(const ponder::UserObject&) {return true;}
 };
 
 /**
@@ -27,28 +27,63 @@
 **
 ****************************************************************************/
 
+
 #include <ponder/args.hpp>
-#include <ponder/value.hpp>
+#include <algorithm>
+#include <iterator>
+#include <memory>
 
 namespace ponder {
     
 const Args Args::empty;
 
-size_t Args::count() const
+Args::Args(const Args& other)
+{
+    copyFrom(other);
+}
+
+Args::Args(Args&& other) noexcept
+{
+    moveFrom(std::move(other));
+}
+
+Args::~Args()
+{
+    clear();
+}
+
+Args& Args::operator=(const Args& other)
 {
-    return m_values.size();
+    if (this != &other)
+    {
+        clear();
+        copyFrom(other);
+    }
+
+    return *this;
+}
+
+Args& Args::operator=(Args&& other) noexcept
+{
+    if (this != &other)
+    {
+        clear();
+        moveFrom(std::move(other));
+    }
+
+    return *this;
 }
 
 const Value& Args::operator[](size_t index) const
 {
     // Make sure that the index is not out of range
-    if (index >= m_values.size())
-        PONDER_ERROR(OutOfRange(index, m_values.size()));
+    if (index >= m_count)
+        PONDER_ERROR(OutOfRange(index, m_count));
 
-    return m_values[index];
+    return values()[index];
 }
 
-Args Args::operator+(const Value& arg) const
+Args Args::operator+(const Value& arg) const &
 {
     Args newArgs(*this);
     newArgs += arg;
@@ -56,17 +91,153 @@ Args Args::operator+(const Value& arg) const
     return newArgs;
 }
 
+Args Args::operator+(const Value& arg) &&
+{
+    Args newArgs(std::move(*this));
+    newArgs += arg;
+
+    return newArgs;
+}
+
 Args& Args::operator+=(const Value& arg)
 {
-    m_values.push_back(arg);
+    append(Value(arg));
+
+    return *this;
+}
+
+Args& Args::operator+=(Value&& arg)
+{
+    append(std::move(arg));
 
     return *this;
 }
 
 Args& Args::insert(size_t index, const Value& v)
 {
-    m_values.insert(m_values.begin() + index, v);
+    if (index > m_count)
+        PONDER_ERROR(OutOfRange(index, m_count));
+
+    if (m_isInline)
+    {
+        if (index == 0 && m_first == 1)
+        {
+            // Free slot in front of the values
+            new (slots()) Value(v);
+            m_first = 0;
+            ++m_count;
+            return *this;
+        }
+
+        if (m_first + m_count < 1 + inlineCapacity)
+        {
+            Value* first = slots() + m_first;
+            if (index == m_count)
+            {
+                new (first + m_count) Value(v);
+            }
+            else
+            {
+                new (first + m_count) Value(std::move(first[m_count - 1]));
+                std::move_backward(first + index, first + m_count - 1, first + m_count);
+                first[index] = v;
+            }
+            ++m_count;
+            return *this;
+        }
+
+        moveToHeap(m_count + 1);
+    }
+
+    m_heap.insert(m_heap.begin() + index, v);
+    ++m_count;
+    return *this;
+}
+
+Args& Args::set(size_t index, const Value& v)
+{
+    if (index >= m_count)
+        PONDER_ERROR(OutOfRange(index, m_count));
+
+    values()[index] = v;
     return *this;
 }
 
+void Args::reserve(size_t count)
+{
+    if (count > inlineCapacity)
+        moveToHeap(count);
+}
+
+void Args::append(Value&& arg)
+{
+    if (m_isInline)
+    {
+        if (m_first + m_count < 1 + inlineCapacity)
+        {
+            new (slots() + m_first + m_count) Value(std::move(arg));
+            ++m_count;
+            return;
+        }
+
+        moveToHeap(m_count + 1);
+    }
+
+    m_heap.push_back(std::move(arg));
+    ++m_count;
+}
+
+void Args::moveToHeap(size_t capacity)
+{
+    std::vector<Value> heap;
+    heap.reserve(std::max(capacity, 2 * inlineCapacity));
+
+    Value* first = slots() + m_first;
+    std::move(first, first + m_count, std::back_inserter(heap));
+    std::destroy_n(first, m_count);
+
+    m_heap = std::move(heap);
+    m_isInline = false;
+}
+
+void Args::clear()
+{
+    if (m_isInline)
+        std::destroy_n(slots() + m_first, m_count);
+    else
+        m_heap.clear();
+
+    m_first = 1;
+    m_count = 0;
+    m_isInline = true;
+}
+
+// Copy or move the values of another list into this one, which is empty.
+void Args::copyFrom(const Args& other)
+{
+    if (other.m_isInline)
+        std::uninitialized_copy_n(other.slots() + other.m_first, other.m_count,
+                                  slots() + other.m_first);
+    else
+        m_heap = other.m_heap;
+
+    m_first = other.m_first;
+    m_count = other.m_count;
+    m_isInline = other.m_isInline;
+}
+
+void Args::moveFrom(Args&& other)
+{
+    if (other.m_isInline)
+        std::uninitialized_move_n(other.slots() + other.m_first, other.m_count,
+                                  slots() + other.m_first);
+    else
+        m_heap = std::move(other.m_heap);
+
+    m_first = other.m_first;
+    m_count = other.m_count;
+    m_isInline = other.m_isInline;
+    other.clear();
+}
+
 } // namespace ponder
@@ -34,21 +34,66 @@ namespace ponder {
 
 Class::Class(TypeId const& id, IdRef name)
 : m_sizeof(0)
+, m_index(0)
 , m_id(id)
 , m_name(name)
+, m_frozen(false)
+, m_objectPool(nullptr)
+, m_objectResource(nullptr)
 {
 }
 
+Class::~Class()
+{
+    // Objects may still be using the pool, it is deleted when they are freed.
+    if (m_objectPool)
+        m_objectPool->release();
+}
+
+void Class::setSizeOf(size_t size)
+{
+    m_sizeof = size;
+    if (m_objectPool)
+        m_objectPool->release();
+    m_objectPool = new detail::ObjectPool(size, std::pmr::get_default_resource());
+    m_objectResource = m_objectPool;
+}
+
 IdReturn Class::name() const
 {
     return m_name;
 }
 
+size_t Class::index() const
+{
+    return m_index;
+}
+
 size_t Class::sizeOf() const
 {
     return m_sizeof;
 }
 
+std::pmr::memory_resource* Class::memoryResource() const
+{
+    return m_objectResource;
+}
+
+bool Class::isFrozen() const
+{
+    return m_frozen;
+}
+
+void Class::freeze()
+{
+    if (m_frozen)
+        return;
+
+    m_properties.buildIndex();
+    m_functions.buildIndex();
+    m_frozen = true;
+}
+
 size_t Class::constructorCount() const
 {
     return m_constructors.size();
@@ -59,6 +104,11 @@ const Constructor* Class::constructor(size_t index) const
     return m_constructors[index].get();
 }
 
+const Constructor* Class::findConstructor(const Args& args) const
+{
+    return m_constructorCache.find(args);
+}
+
 void Class::destruct(const UserObject &uobj, bool destruct) const
 {
     m_destructor(uobj, destruct);
@@ -88,6 +138,11 @@ bool Class::hasFunction(IdRef id) const
     return m_functions.containsKey(id);
 }
 
+bool Class::hasFunction(HashedId id) const
+{
+    return m_functions.findHashed(id.name(), id.hash()) != m_functions.end();
+}
+
 const Function& Class::function(size_t index) const
 {
     // Make sure that the index is not out of range
@@ -111,6 +166,42 @@ const Function& Class::function(IdRef id) const
     return *it->second;
 }
 
+const Function& Class::function(HashedId id) const
+{
+    FunctionTable::const_iterator it = m_functions.findHashed(id.name(), id.hash());
+    if (it == m_functions.end())
+    {
+        PONDER_ERROR(FunctionNotFound(Id(id.name()), name()));
+    }
+
+    return *it->second;
+}
+
+FunctionHandle Class::functionHandle(IdRef id) const
+{
+    FunctionTable::const_iterator it;
+    if (!m_functions.tryFind(id, it))
+    {
+        PONDER_ERROR(FunctionNotFound(id, name()));
+    }
+
+    return FunctionHandle(this, static_cast<size_t>(it - m_functions.begin()));
+}
+
+const Function& Class::functionFromHandle(FunctionHandle handle) const
+{
+    const Class* owner = handle.getClass();
+    if (!owner)
+        PONDER_ERROR(FunctionNotFound("", name()));
+    if (owner == this)
+        PONDER_ERROR(OutOfRange(handle.index(), m_functions.size()));
+    if (!isA(*owner))
+        PONDER_ERROR(ClassUnrelated(name(), owner->name()));
+
+    // The base's function applies to this class' objects too
+    return owner->function(handle);
+}
+
 size_t Class::propertyCount() const
 {
     return m_properties.size();
@@ -121,6 +212,11 @@ bool Class::hasProperty(IdRef id) const
     return m_properties.containsKey(id);
 }
 
+bool Class::hasProperty(HashedId id) const
+{
+    return m_properties.findHashed(id.name(), id.hash()) != m_properties.end();
+}
+
 const Property& Class::property(size_t index) const
 {
     // Make sure that the index is not out of range
@@ -144,6 +240,42 @@ const Property& Class::property(IdRef id) const
     return *it->second;
 }
 
+const Property& Class::property(HashedId id) const
+{
+    PropertyTable::const_iterator it = m_properties.findHashed(id.name(), id.hash());
+    if (it == m_properties.end())
+    {
+        PONDER_ERROR(PropertyNotFound(Id(id.name()), name()));
+    }
+
+    return *it->second;
+}
+
+PropertyHandle Class::propertyHandle(IdRef id) const
+{
+    PropertyTable::const_iterator it;
+    if (!m_properties.tryFind(id, it))
+    {
+        PONDER_ERROR(PropertyNotFound(id, name()));
+    }
+
+    return PropertyHandle(this, static_cast<size_t>(it - m_properties.begin()));
+}
+
+const Property& Class::propertyFromHandle(PropertyHandle handle) const
+{
+    const Class* owner = handle.getClass();
+    if (!owner)
+        PONDER_ERROR(PropertyNotFound("", name()));
+    if (owner == this)
+        PONDER_ERROR(OutOfRange(handle.index(), m_properties.size()));
+    if (!isA(*owner))
+        PONDER_ERROR(ClassUnrelated(name(), owner->name()));
+
+    // The base's property applies to this class' objects too
+    return owner->property(handle);
+}
+
 void Class::visit(ClassVisitor& visitor) const
 {
     // First visit properties
@@ -159,10 +291,20 @@ void Class::visit(ClassVisitor& visitor) const
     }
 }
 
+bool Class::isA(const Class& base) const
+{
+    return baseOffset(base) != -1;
+}
+
+bool Class::isBaseOf(const Class& derived) const
+{
+    return derived.baseOffset(*this) != -1;
+}
+
 void* Class::applyOffset(void* pointer, const Class& target) const
 {
-    // Special case for null pointers: don't apply offset to leave them null
-    if (!pointer)
+    // Special case for null pointers and same class: no offset
+    if (!pointer || &target == this)
         return pointer;
 
     // Check target as a base class of this
@@ -195,15 +337,38 @@ int Class::baseOffset(const Class& base) const
     if (&base == this)
         return 0;
 
-    // Search base in the base classes
-    for (auto const& b : m_bases)
-    {
-        const int offset = b.base->baseOffset(base);
-        if (offset != -1)
-            return offset + b.offset;
-    }
+    // Look up base in the flattened ancestors. Indices may be reused, so check the class.
+    const std::uint32_t i = m_ancestorIndex.find(base.m_index);
+    if (i != detail::IntegerIndex<size_t>::npos && m_ancestors[i].base == &base)
+        return m_ancestors[i].offset;
 
     return -1;
 }
 
+void Class::addBase(const Class& base, int offset)
+{
+    m_bases.push_back(BaseInfo{&base, offset});
+
+    // Ancestors are kept in the order of a depth first search through the bases, so the
+    // first path found to a repeated (non-virtual) base is the one used, as before.
+    auto addAncestor = [this](const Class* ancestor, int ancestorOffset) {
+        for (auto const& a : m_ancestors)
+        {
+            if (a.base == ancestor)
+                return;
+        }
+        m_ancestors.push_back(BaseInfo{ancestor, ancestorOffset});
+    };
+
+    addAncestor(&base, offset);
+    for (auto const& a : base.m_ancestors)
+        addAncestor(a.base, a.offset + offset);
+
+    std::vector<size_t> indices;
+    indices.reserve(m_ancestors.size());
+    for (auto const& a : m_ancestors)
+        indices.push_back(a.base->m_index);
+    m_ancestorIndex.build(indices);
+}
+
 } // namespace ponder
@@ -37,4 +37,9 @@ void* classCast(void* pointer, const Class& sourceClass, const Class& targetClas
     return sourceClass.applyOffset(pointer, targetClass);
 }
 
+bool canClassCast(const Class& sourceClass, const Class& targetClass)
+{
+    return sourceClass.isA(targetClass) || targetClass.isA(sourceClass);
+}
+
 } // namespace ponder
@@ -29,6 +29,8 @@
 
 #include <ponder/detail/classmanager.hpp>
 #include <ponder/class.hpp>
+#include <ponder/pondertype.hpp>
+#include <algorithm>
 
 namespace ponder {
 namespace detail {
@@ -51,9 +53,10 @@ Class& ClassManager::addClass(TypeId const& id, IdRef name)
     // Create the new class
     Class *newClass = new Class(id, name);
 
-    // Insert it into the table
+    // Insert it into the tables
+    newClass->m_index = m_indices.add(newClass);
     m_classes.insert(std::make_pair(id, newClass));
-    m_names.insert(std::make_pair(Id(name), newClass));
+    m_names.insert(std::make_pair(string_view(newClass->name()), newClass));
 
     // Notify observers
     notifyClassAdded(*newClass);
@@ -71,14 +74,18 @@ void ClassManager::removeClass(TypeId const& id)
 
     auto it = m_classes.find(id);
     Class* classPtr{ it->second };
-    auto itName = m_names.find(classPtr->m_name);
+    auto itName = m_names.find(string_view(classPtr->name()));
 
     // Notify observers
     notifyClassRemoved(*classPtr);
 
-    m_names.erase(itName);
+    if (itName != m_names.end() && itName->second == classPtr)
+        m_names.erase(itName);
+    clearCache(*classPtr);
+    m_indices.remove(classPtr->m_index);
     delete classPtr;
     m_classes.erase(it);
+    clearTypeRegistration(id); // An auto type registers again when next used
 }
     
 size_t ClassManager::count() const
@@ -86,6 +93,12 @@ size_t ClassManager::count() const
     return m_classes.size();
 }
 
+void ClassManager::freezeClasses()
+{
+    for (auto& it : m_classes)
+        it.second->freeze();
+}
+
 ClassManager::ClassView ClassManager::getClasses() const
 {
     return ClassView(m_classes.begin(), m_classes.end());
@@ -97,6 +110,16 @@ const Class* ClassManager::getByIdSafe(TypeId const& id) const
     return (it == m_classes.end()) ? nullptr : it->second;
 }
 
+const Class* ClassManager::getByIndex(size_t index) const
+{
+    return m_indices.get(index);
+}
+
+size_t ClassManager::indexCount() const
+{
+    return m_indices.size();
+}
+
 const Class& ClassManager::getById(TypeId const& id) const
 {
     const Class* cls{ getByIdSafe(id) };
@@ -108,8 +131,7 @@ const Class& ClassManager::getById(TypeId const& id) const
 
 const Class* ClassManager::getByNameSafe(const IdRef name) const
 {
-    NameTable::const_iterator it{ std::find_if(m_names.begin(), m_names.end(),
-        [=](const std::pair<Id, Class*>& a) { return a.first.compare(name) == 0; } ) };
+    NameTable::const_iterator it{ m_names.find(string_view(name)) };
     return (it == m_names.end()) ? nullptr : it->second;
 }
 
@@ -138,9 +160,27 @@ ClassManager::~ClassManager()
     {
         Class* classPtr = it->second;
         notifyClassRemoved(*classPtr);
+        clearCache(*classPtr);
         delete classPtr;
     }
 }
 
+void ClassManager::bindCache(Class& cls, ClassCacheSlot& slot)
+{
+    if (std::find(cls.m_cacheSlots.begin(), cls.m_cacheSlots.end(), &slot)
+            == cls.m_cacheSlots.end())
+    {
+        cls.m_cacheSlots.push_back(&slot);
+    }
+    slot.store(&cls, std::memory_order_release);
+}
+
+void ClassManager::clearCache(Class& cls)
+{
+    for (ClassCacheSlot* slot : cls.m_cacheSlots)
+        slot->store(nullptr, std::memory_order_release);
+    cls.m_cacheSlots.clear();
+}
+
 } // namespace ponder
 } // namespace detail
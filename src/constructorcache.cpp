@@ -0,0 +1,152 @@
+/****************************************************************************
+**
+** This file is part of the Ponder library, formerly CAMP.
+**
+** The MIT License (MIT)
+**
+** Copyright (C) 2009-2014 TEGESO/TEGESOFT and/or its subsidiary(-ies) and mother company.
+** Copyright (C) 2015-2020 Nick Trout.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a copy
+** of this software and associated documentation files (the "Software"), to deal
+** in the Software without restriction, including without limitation the rights
+** to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+** copies of the Software, and to permit persons to whom the Software is
+** furnished to do so, subject to the following conditions:
+** 
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+** 
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+** OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+** THE SOFTWARE.
+**
+****************************************************************************/
+
+#include <ponder/detail/constructorcache.hpp>
+#include <ponder/args.hpp>
+#include <ponder/constructor.hpp>
+#include <ponder/enumobject.hpp>
+#include <ponder/userobject.hpp>
+#include <atomic>
+#include <cstdint>
+
+namespace ponder {
+namespace detail {
+
+namespace {
+
+// Kind of an argument, with its metaclass or metaenum
+struct ArgType
+{
+    ValueKind kind;
+    const void* type;
+};
+
+struct Entry
+{
+    const ConstructorCache* owner;
+    std::uint64_t generation;
+    std::size_t count;
+    ArgType args[ConstructorCache::c_maxCachedArgs];
+    const Constructor* constructor;
+};
+
+constexpr std::size_t c_entryCount = 32; // Power of 2
+
+// Cached resolutions of the current thread.
+thread_local Entry t_entries[c_entryCount];
+
+// Entries of older generations are invalid. Entries start at generation 0.
+std::atomic<std::uint64_t> g_generation{1};
+
+ArgType argType(const Value& value)
+{
+    switch (value.kind())
+    {
+        case ValueKind::User:
+            return {ValueKind::User, &value.cref<UserObject>().getClass()};
+        case ValueKind::Enum:
+            return {ValueKind::Enum, &value.cref<EnumObject>().getEnum()};
+        default:
+            return {value.kind(), nullptr};
+    }
+}
+
+} // namespace
+
+ConstructorCache::~ConstructorCache()
+{
+    // The address may be reused by another cache
+    clear();
+}
+
+void ConstructorCache::add(const Constructor* constructor, std::size_t paramCount)
+{
+    if (m_byArity.size() <= paramCount)
+        m_byArity.resize(paramCount + 1);
+    m_byArity[paramCount].push_back(constructor);
+
+    clear();
+}
+
+const Constructor* ConstructorCache::find(const Args& args) const
+{
+    const std::size_t count = args.count();
+    if (count >= m_byArity.size() || m_byArity[count].empty())
+        return nullptr;
+
+    if (count > c_maxCachedArgs)
+        return resolve(count, args);
+
+    ArgType types[c_maxCachedArgs];
+    std::uint64_t h = (14695981039346656037ull ^ reinterpret_cast<std::uintptr_t>(this))
+                      * 1099511628211ull;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        types[i] = argType(args[i]);
+        h = (h ^ static_cast<std::uint64_t>(types[i].kind)) * 1099511628211ull;
+        h = (h ^ reinterpret_cast<std::uintptr_t>(types[i].type)) * 1099511628211ull;
+    }
+
+    const std::uint64_t generation = g_generation.load(std::memory_order_acquire);
+    Entry& entry = t_entries[(h ^ (h >> 32)) & (c_entryCount - 1)];
+
+    bool hit = entry.owner == this && entry.generation == generation && entry.count == count;
+    for (std::size_t i = 0; hit && i < count; ++i)
+        hit = entry.args[i].kind == types[i].kind && entry.args[i].type == types[i].type;
+    if (hit)
+        return entry.constructor;
+
+    const Constructor* constructor = resolve(count, args);
+
+    entry.owner = this;
+    entry.generation = generation;
+    entry.count = count;
+    for (std::size_t i = 0; i < count; ++i)
+        entry.args[i] = types[i];
+    entry.constructor = constructor;
+    return constructor;
+}
+
+void ConstructorCache::clear()
+{
+    g_generation.fetch_add(1, std::memory_order_acq_rel);
+}
+
+const Constructor* ConstructorCache::resolve(std::size_t arity, const Args& args) const
+{
+    for (const Constructor* constructor : m_byArity[arity])
+    {
+        if (constructor->matches(args))
+            return constructor;
+    }
+    return nullptr;
+}
+
+} // namespace detail
+} // namespace ponder
@@ -34,6 +34,7 @@ namespace ponder {
 
 Enum::Enum(IdRef name)
     :   m_name(name)
+    ,   m_index(0)
 {
 }
 
@@ -42,6 +43,11 @@ IdReturn Enum::name() const
     return m_name;
 }
 
+size_t Enum::index() const
+{
+    return m_index;
+}
+
 size_t Enum::size() const
 {
     return m_enums.size();
@@ -64,17 +70,17 @@ bool Enum::hasName(IdRef name) const
 
 bool Enum::hasValue(EnumValue value) const
 {
-    return m_enums.containsValue(value);
+    return findValue(value) != ValueIndex::npos;
 }
 
 IdReturn Enum::name(EnumValue value) const
 {
-    auto it = m_enums.findValue(value);
+    const std::uint32_t i = findValue(value);
     
-    if (it == m_enums.end())
+    if (i == ValueIndex::npos)
         PONDER_ERROR(EnumValueNotFound(value, name()));
 
-    return it->first;
+    return m_enums.at(i)->first;
 }
 
 Enum::EnumValue Enum::value(IdRef name) const
@@ -87,6 +93,36 @@ Enum::EnumValue Enum::value(IdRef name) const
     return it->second;
 }
 
+void Enum::addValue(IdRef name, EnumValue value)
+{
+    m_enums.insert(name, value);
+    m_values.clear();
+}
+
+void Enum::buildIndex()
+{
+    if (!m_values.empty())
+        return; // already indexed
+
+    m_enums.buildIndex();
+
+    std::vector<EnumValue> values;
+    values.reserve(m_enums.size());
+    for (auto&& it : m_enums)
+        values.push_back(it.second);
+    m_values.build(values);
+}
+
+std::uint32_t Enum::findValue(EnumValue value) const
+{
+    if (!m_values.empty())
+        return m_values.find(value);
+
+    auto it = m_enums.findValue(value);
+    return it == m_enums.end() ? ValueIndex::npos
+                               : static_cast<std::uint32_t>(it - m_enums.begin());
+}
+
 bool Enum::operator == (const Enum& other) const
 {
     return name() == other.name();
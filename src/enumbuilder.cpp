@@ -37,12 +37,17 @@ EnumBuilder::EnumBuilder(Enum& target)
 {
 }
 
+EnumBuilder::~EnumBuilder()
+{
+    m_target->buildIndex();
+}
+
 EnumBuilder& EnumBuilder::value(IdRef name, Enum::EnumValue value)
 {
     assert(!m_target->hasName(name));
     assert(!m_target->hasValue(value));
 
-    m_target->m_enums.insert(name, value);
+    m_target->addValue(name, value);
 
     return *this;
 }
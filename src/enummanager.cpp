@@ -28,8 +28,10 @@
 ****************************************************************************/
 
 #include <ponder/detail/enummanager.hpp>
+#include <ponder/detail/constructorcache.hpp>
 #include <ponder/enum.hpp>
 #include <ponder/errors.hpp>
+#include <ponder/pondertype.hpp>
 
 namespace ponder {
 namespace detail {
@@ -51,9 +53,10 @@ Enum& EnumManager::addClass(TypeId const& id, IdRef name)
     // Create the new class
     Enum* newEnum = new Enum(name);
 
-    // Insert it into the table
+    // Insert it into the tables
+    newEnum->m_index = m_indices.add(newEnum);
     m_enums.insert(std::make_pair(id, newEnum));
-    m_names.insert(std::make_pair(name, newEnum));
+    m_names.insert(std::make_pair(string_view(newEnum->name()), newEnum));
 
     // Notify observers
     notifyEnumAdded(*newEnum);
@@ -73,9 +76,14 @@ void EnumManager::removeClass(TypeId const& id)
     // Notify observers
     notifyEnumRemoved(*en);
 
-    m_names.erase(en->name());
+    auto itName = m_names.find(string_view(en->name()));
+    if (itName != m_names.end() && itName->second == en)
+        m_names.erase(itName);
+    m_indices.remove(en->m_index);
     delete en;
     m_enums.erase(id);
+    clearTypeRegistration(id); // An auto type registers again when next used
+    ConstructorCache::clear(); // Resolutions may refer to the metaenum
 }
 
 size_t EnumManager::count() const
@@ -89,6 +97,16 @@ const Enum* EnumManager::getByIdSafe(TypeId const& id) const
     return it == m_enums.end() ? nullptr : it->second;
 }
 
+const Enum* EnumManager::getByIndex(size_t index) const
+{
+    return m_indices.get(index);
+}
+
+size_t EnumManager::indexCount() const
+{
+    return m_indices.size();
+}
+
 const Enum& EnumManager::getById(TypeId const& id) const
 {
     const Enum* e{ getByIdSafe(id) };
@@ -100,9 +118,7 @@ const Enum& EnumManager::getById(TypeId const& id) const
 
 const Enum* EnumManager::getByNameSafe(const IdRef name) const 
 {
-    const auto it{ std::find_if(m_names.begin(), m_names.end(),
-        [&name](const auto& a) { return a.first.compare(name.data()) == 0; } ) };
-
+    const auto it{ m_names.find(string_view(name)) };
     return it == m_names.end() ? nullptr : it->second;
 }
 
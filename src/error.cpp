@@ -28,8 +28,17 @@
 ****************************************************************************/
 
 #include <ponder/error.hpp>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
 
 namespace ponder {
+
+namespace {
+
+std::atomic<ErrorHandler> g_errorHandler {nullptr};
+
+} // namespace
     
 Error::~Error() throw()
 {
@@ -51,4 +60,23 @@ Error::Error(IdRef message)
 {
 }
 
+ErrorHandler setErrorHandler(ErrorHandler handler)
+{
+    return g_errorHandler.exchange(handler);
+}
+
+namespace detail {
+
+void raiseError(const Error& error)
+{
+    if (ErrorHandler handler = g_errorHandler.load())
+        handler(error);
+
+    // The handler returned, or there isn't one
+    std::fprintf(stderr, "Ponder error: %s (%s)\n", error.what(), error.where());
+    std::abort();
+}
+
+} // namespace detail
+
 } // namespace ponder
@@ -60,11 +60,22 @@ BadArgument::BadArgument(ValueKind provided,
 {
 }
 
+BadSignature::BadSignature(IdRef functionName, size_t paramCount)
+: BadType("function " + String(functionName) +
+          " doesn't have the requested signature with " + str(paramCount) + " parameters")
+{
+}
+
 ClassAlreadyCreated::ClassAlreadyCreated(IdRef type)
     : Error("class named " + String(type) + " already exists")
 {
 }
 
+ClassFrozen::ClassFrozen(IdRef name)
+    : Error("the metaclass " + String(name) + " is frozen and can't be modified")
+{
+}
+
 ClassNotFound::ClassNotFound(IdRef name)
     : Error("the metaclass " + String(name) + " couldn't be found")
 {
@@ -52,4 +52,9 @@ void Function::accept(ClassVisitor& visitor) const
     visitor.visit(*this);
 }
 
+profiling::FunctionStats Function::stats() const
+{
+    return m_profile.stats();
+}
+
 } // namespace ponder
@@ -0,0 +1,120 @@
+/****************************************************************************
+ **
+ ** This file is part of the Ponder library, formerly CAMP.
+ **
+ ** The MIT License (MIT)
+ **
+ ** Copyright (C) 2009-2014 TEGESO/TEGESOFT and/or its subsidiary(-ies) and mother company.
+ ** Copyright (C) 2015-2020 Nick Trout.
+ **
+ ** Permission is hereby granted, free of charge, to any person obtaining a copy
+ ** of this software and associated documentation files (the "Software"), to deal
+ ** in the Software without restriction, including without limitation the rights
+ ** to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ ** copies of the Software, and to permit persons to whom the Software is
+ ** furnished to do so, subject to the following conditions:
+ **
+ ** The above copyright notice and this permission notice shall be included in
+ ** all copies or substantial portions of the Software.
+ **
+ ** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ ** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ ** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ ** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ ** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ ** OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ ** THE SOFTWARE.
+ **
+ ****************************************************************************/
+
+#include <ponder/detail/internedid.hpp>
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace ponder {
+namespace detail {
+
+namespace {
+
+// Global table of interned names. Symbols are never removed so ids stay valid.
+class SymbolTable
+{
+public:
+
+    static SymbolTable& instance()
+    {
+        static SymbolTable table;
+        return table;
+    }
+
+    const InternedId::Symbol* find(string_view str) const
+    {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        auto it = m_index.find(str);
+        return it != m_index.end() ? it->second : nullptr;
+    }
+
+    const InternedId::Symbol* intern(string_view str)
+    {
+        if (const InternedId::Symbol* sym = find(str))
+            return sym;
+
+        std::unique_lock<std::shared_mutex> lock(m_mutex);
+        auto it = m_index.find(str);    // may have been added whilst unlocked
+        if (it != m_index.end())
+            return it->second;
+
+        // deque does not move elements, so the index can view the symbol strings
+        m_symbols.push_back(InternedId::Symbol{std::string(str.data(), str.size()),
+                                               hashString(str)});
+        const InternedId::Symbol* sym = &m_symbols.back();
+        m_index.emplace(string_view(sym->str), sym);
+        return sym;
+    }
+
+    std::size_t size() const
+    {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        return m_symbols.size();
+    }
+
+private:
+
+    mutable std::shared_mutex m_mutex;
+    std::deque<InternedId::Symbol> m_symbols;
+    std::unordered_map<string_view, const InternedId::Symbol*, StringViewHash> m_index;
+};
+
+} // namespace
+
+const InternedId::Symbol* InternedId::intern(string_view str)
+{
+    if (str.empty())
+        return nullptr;
+
+    return SymbolTable::instance().intern(str);
+}
+
+InternedId InternedId::find(string_view str)
+{
+    if (str.empty())
+        return InternedId();
+
+    return InternedId(SymbolTable::instance().find(str));
+}
+
+std::size_t InternedId::symbolCount()
+{
+    return SymbolTable::instance().size();
+}
+
+const std::string& InternedId::emptyString()
+{
+    static const std::string empty;
+    return empty;
+}
+
+} // namespace detail
+} // namespace ponder
@@ -0,0 +1,138 @@
+/****************************************************************************
+**
+** This file is part of the Ponder library, formerly CAMP.
+**
+** The MIT License (MIT)
+**
+** Copyright (C) 2009-2014 TEGESO/TEGESOFT and/or its subsidiary(-ies) and mother company.
+** Copyright (C) 2015-2020 Nick Trout.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a copy
+** of this software and associated documentation files (the "Software"), to deal
+** in the Software without restriction, including without limitation the rights
+** to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+** copies of the Software, and to permit persons to whom the Software is
+** furnished to do so, subject to the following conditions:
+** 
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+** 
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+** OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+** THE SOFTWARE.
+**
+****************************************************************************/
+
+#include <ponder/detail/objectpool.hpp>
+#include <cstddef>
+
+namespace ponder {
+namespace detail {
+
+namespace {
+
+// Blocks hold the object, its holder and the shared count of the holder.
+constexpr std::size_t c_holderOverhead = 8 * sizeof(void*);
+constexpr std::size_t c_blockAlign = alignof(std::max_align_t);
+constexpr std::size_t c_firstChunkBlocks = 16, c_maxChunkBlocks = 1024;
+
+} // namespace
+
+ObjectPool::ObjectPool(std::size_t objectSize, std::pmr::memory_resource* upstream)
+    : m_upstream(upstream)
+    , m_blockSize((objectSize + c_holderOverhead + c_blockAlign - 1) & ~(c_blockAlign - 1))
+    , m_chunkBlocks(c_firstChunkBlocks)
+    , m_free(nullptr)
+    , m_used(0)
+    , m_released(false)
+{
+}
+
+ObjectPool::~ObjectPool()
+{
+    for (auto const& chunk : m_chunks)
+        m_upstream->deallocate(chunk.first, chunk.second, c_blockAlign);
+}
+
+void ObjectPool::release()
+{
+    bool unused;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_released = true;
+        unused = m_used == 0;
+    }
+    if (unused)
+        delete this;
+}
+
+void* ObjectPool::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+    // Larger blocks come from upstream, but are counted so the pool stays alive to
+    // return them.
+    if (bytes > m_blockSize || alignment > c_blockAlign)
+    {
+        void* p = m_upstream->allocate(bytes, alignment);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_used;
+        return p;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_free)
+        grow();
+    Block* block = m_free;
+    m_free = block->next;
+    ++m_used;
+    return block;
+}
+
+void ObjectPool::do_deallocate(void* p, std::size_t bytes, std::size_t alignment)
+{
+    const bool upstream = bytes > m_blockSize || alignment > c_blockAlign;
+    if (upstream)
+        m_upstream->deallocate(p, bytes, alignment);
+
+    bool unused;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!upstream)
+        {
+            Block* block = static_cast<Block*>(p);
+            block->next = m_free;
+            m_free = block;
+        }
+        unused = --m_used == 0 && m_released;
+    }
+    if (unused)
+        delete this;
+}
+
+bool ObjectPool::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+    return this == &other;
+}
+
+void ObjectPool::grow()
+{
+    const std::size_t size = m_blockSize * m_chunkBlocks;
+    char* chunk = static_cast<char*>(m_upstream->allocate(size, c_blockAlign));
+    m_chunks.emplace_back(chunk, size);
+
+    for (std::size_t i = m_chunkBlocks; i-- > 0; )
+    {
+        Block* block = reinterpret_cast<Block*>(chunk + i * m_blockSize);
+        block->next = m_free;
+        m_free = block;
+    }
+
+    if (m_chunkBlocks < c_maxChunkBlocks)
+        m_chunkBlocks *= 2;
+}
+
+} // namespace detail
+} // namespace ponder
@@ -30,10 +30,33 @@
 #include <ponder/pondertype.hpp>
 #include <ponder/detail/classmanager.hpp>
 #include <ponder/detail/enummanager.hpp>
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 namespace ponder {
 namespace detail {
-    
+
+namespace {
+
+// Recursive, as registration functions may reference other auto registered types.
+std::recursive_mutex& registrationMutex()
+{
+    static std::recursive_mutex s_mutex;
+    return s_mutex;
+}
+
+// Flags of the registered types, so they can be cleared when the type is removed.
+std::unordered_map<TypeId, std::atomic<bool>*>& registrationFlags()
+{
+    static std::unordered_map<TypeId, std::atomic<bool>*> s_flags;
+    return s_flags;
+}
+
+} // namespace
+
+
 void ensureTypeRegistered(TypeId const& id, void (*registerFunc)())
 {
     if (registerFunc
@@ -44,5 +67,50 @@ void ensureTypeRegistered(TypeId const& id, void (*registerFunc)())
     }
 }
 
+void registerTypeOnce(std::atomic<bool>& registered, TypeId const& id, void (*registerFunc)())
+{
+    // Types being registered on this thread. Their registration functions may reference
+    // them again, but the flag is only set once registration is complete.
+    static thread_local std::vector<std::atomic<bool>*> s_inProgress;
+
+    std::lock_guard<std::recursive_mutex> lock(registrationMutex());
+    if (registered.load(std::memory_order_relaxed)
+        || std::find(s_inProgress.begin(), s_inProgress.end(), &registered) != s_inProgress.end())
+    {
+        return;
+    }
+
+    s_inProgress.push_back(&registered);
+#if PONDER_EXCEPTIONS
+    try
+    {
+        ensureTypeRegistered(id, registerFunc);
+    }
+    catch (...)
+    {
+        s_inProgress.pop_back();
+        throw;
+    }
+#else
+    ensureTypeRegistered(id, registerFunc);
+#endif
+    s_inProgress.pop_back();
+
+    registrationFlags()[id] = &registered;
+    registered.store(true, std::memory_order_release);
+}
+
+void clearTypeRegistration(TypeId const& id)
+{
+    std::lock_guard<std::recursive_mutex> lock(registrationMutex());
+    auto& flags = registrationFlags();
+    auto it = flags.find(id);
+    if (it != flags.end())
+    {
+        it->second->store(false, std::memory_order_release);
+        flags.erase(it);
+    }
+}
+
 } // namespace detail
 } // namespace ponder
@@ -0,0 +1,335 @@
+/****************************************************************************
+**
+** This file is part of the Ponder library, formerly CAMP.
+**
+** The MIT License (MIT)
+**
+** Copyright (C) 2009-2014 TEGESO/TEGESOFT and/or its subsidiary(-ies) and mother company.
+** Copyright (C) 2015-2020 Nick Trout.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a copy
+** of this software and associated documentation files (the "Software"), to deal
+** in the Software without restriction, including without limitation the rights
+** to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+** copies of the Software, and to permit persons to whom the Software is
+** furnished to do so, subject to the following conditions:
+** 
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+** 
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+** OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+** THE SOFTWARE.
+**
+****************************************************************************/
+
+#include <ponder/profiling.hpp>
+#include <ponder/classget.hpp>
+#include <ponder/class.hpp>
+#include <ponder/function.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+namespace ponder {
+namespace profiling {
+
+namespace {
+
+// Index of the most significant bit set, value must not be 0.
+unsigned highestBit(std::uint64_t value)
+{
+#if defined(__GNUC__)
+    return 63 - __builtin_clzll(value);
+#else
+    unsigned bit = 0;
+    while (value >>= 1)
+        ++bit;
+    return bit;
+#endif
+}
+
+// Statistics of a function on one thread.
+struct Entry
+{
+    std::atomic<std::uint64_t> calls;
+    std::atomic<std::uint64_t> exceptions;
+    std::atomic<std::uint64_t> totalNs;
+    std::atomic<std::uint64_t> buckets[Histogram::bucketCount];
+};
+
+// Only the thread owning an entry writes to it, so no atomic read-modify-write is needed.
+// The counters are atomic so that they can be read while they are written.
+inline void add(std::atomic<std::uint64_t>& counter, std::uint64_t n)
+{
+    counter.store(counter.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+}
+
+inline std::uint64_t get(const std::atomic<std::uint64_t>& counter)
+{
+    return counter.load(std::memory_order_relaxed);
+}
+
+struct Shard;
+
+struct Registry
+{
+    std::mutex mutex;                           // Guards the shards and their entry tables
+    std::atomic<size_t> nextIndex {0};          // Next function index
+    std::vector<Shard*> shards;                 // Shards of the running threads
+    std::vector<std::unique_ptr<Entry>> exited; // Statistics of the threads which exited
+};
+
+// Never destroyed, as threads may exit after the static objects are destroyed.
+Registry& registry()
+{
+    static Registry* instance = new Registry;
+    return *instance;
+}
+
+void addEntry(std::vector<std::unique_ptr<Entry>>& entries, size_t index, const Entry& entry)
+{
+    if (index >= entries.size())
+        entries.resize(index + 1);
+    if (!entries[index])
+        entries[index].reset(new Entry());
+
+    Entry& to = *entries[index];
+    add(to.calls, get(entry.calls));
+    add(to.exceptions, get(entry.exceptions));
+    add(to.totalNs, get(entry.totalNs));
+    for (size_t i = 0; i < Histogram::bucketCount; ++i)
+        add(to.buckets[i], get(entry.buckets[i]));
+}
+
+// Statistics of the functions called by a thread, indexed by function.
+struct Shard
+{
+    std::vector<std::unique_ptr<Entry>> entries;
+
+    Shard()
+    {
+        Registry& reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        reg.shards.push_back(this);
+    }
+
+    ~Shard()
+    {
+        Registry& reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        for (size_t i = 0; i < entries.size(); ++i)
+        {
+            if (entries[i])
+                addEntry(reg.exited, i, *entries[i]);
+        }
+        reg.shards.erase(std::find(reg.shards.begin(), reg.shards.end(), this));
+    }
+};
+
+thread_local Shard t_shard;
+
+// Get the entry of a function for the current thread.
+Entry& localEntry(size_t index)
+{
+    Shard& shard = t_shard;
+    if (index < shard.entries.size() && shard.entries[index])
+        return *shard.entries[index];
+
+    // First call of the function on this thread. Readers walk the entry tables so they
+    // only change under the lock.
+    std::lock_guard<std::mutex> lock(registry().mutex);
+    if (index >= shard.entries.size())
+        shard.entries.resize(index + 1);
+    shard.entries[index].reset(new Entry());
+    return *shard.entries[index];
+}
+
+void writeString(std::ostream& stream, const char* str, size_t size)
+{
+    static const char hex[] = "0123456789abcdef";
+
+    stream << '"';
+    for (size_t i = 0; i < size; ++i)
+    {
+        const unsigned char c = static_cast<unsigned char>(str[i]);
+        if (c == '"' || c == '\\')
+            stream << '\\' << c;
+        else if (c < 0x20)
+            stream << "\\u00" << hex[c >> 4] << hex[c & 0xf];
+        else
+            stream << c;
+    }
+    stream << '"';
+}
+
+} // namespace
+
+//-------------------------------------------------------------------------------------------------
+
+size_t Histogram::bucketIndex(std::uint64_t value)
+{
+    // Values with no more bits than a sub-bucket index are counted exactly
+    if (value < (std::uint64_t(2) << subBucketBits))
+        return static_cast<size_t>(value);
+
+    value = std::min(value, maxValue);
+    const unsigned bit = highestBit(value);
+    const unsigned shift = bit - subBucketBits;
+    const size_t subBucket = static_cast<size_t>(value >> shift) & ((1u << subBucketBits) - 1);
+    return ((shift + 1) << subBucketBits) + subBucket;
+}
+
+std::uint64_t Histogram::bucketMax(size_t index)
+{
+    if (index < (size_t(2) << subBucketBits))
+        return index;
+
+    const unsigned shift = static_cast<unsigned>(index >> subBucketBits) - 1;
+    const std::uint64_t subBucket = (index & ((1u << subBucketBits) - 1)) | (1u << subBucketBits);
+    return ((subBucket + 1) << shift) - 1;
+}
+
+void Histogram::merge(const Histogram& other)
+{
+    for (size_t i = 0; i < bucketCount; ++i)
+        m_counts[i] += other.m_counts[i];
+}
+
+std::uint64_t Histogram::count() const
+{
+    std::uint64_t total = 0;
+    for (std::uint64_t n : m_counts)
+        total += n;
+    return total;
+}
+
+std::uint64_t Histogram::percentile(double percent) const
+{
+    const std::uint64_t total = count();
+    if (total == 0)
+        return 0;
+
+    // Rank of the value, from 1 to total
+    const double rank = std::ceil(std::min(std::max(percent, 0.0), 100.0) * total / 100.0);
+    const std::uint64_t target = std::max<std::uint64_t>(static_cast<std::uint64_t>(rank), 1);
+
+    std::uint64_t seen = 0;
+    for (size_t i = 0; i < bucketCount; ++i)
+    {
+        seen += m_counts[i];
+        if (seen >= target)
+            return bucketMax(i);
+    }
+    return bucketMax(bucketCount - 1);
+}
+
+//-------------------------------------------------------------------------------------------------
+
+namespace detail {
+
+CallProfile::CallProfile()
+    : m_index(registry().nextIndex++)
+{
+}
+
+CallProfile::~CallProfile()
+{
+    // Indices aren't reused, free the entries of the function
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    for (Shard* shard : reg.shards)
+    {
+        if (m_index < shard->entries.size())
+            shard->entries[m_index].reset();
+    }
+    if (m_index < reg.exited.size())
+        reg.exited[m_index].reset();
+}
+
+void CallProfile::record(std::uint64_t ns, bool threw) const
+{
+    Entry& entry = localEntry(m_index);
+    add(entry.calls, 1);
+    if (threw)
+        add(entry.exceptions, 1);
+    add(entry.totalNs, ns);
+    add(entry.buckets[Histogram::bucketIndex(ns)], 1);
+}
+
+FunctionStats CallProfile::stats() const
+{
+    FunctionStats stats;
+    const auto merge = [&](const std::vector<std::unique_ptr<Entry>>& entries)
+    {
+        if (m_index >= entries.size() || !entries[m_index])
+            return;
+
+        const Entry& entry = *entries[m_index];
+        stats.calls += get(entry.calls);
+        stats.exceptions += get(entry.exceptions);
+        stats.totalNs += get(entry.totalNs);
+        for (size_t i = 0; i < Histogram::bucketCount; ++i)
+            stats.latency.m_counts[i] += get(entry.buckets[i]);
+    };
+
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    for (const Shard* shard : reg.shards)
+        merge(shard->entries);
+    merge(reg.exited);
+    return stats;
+}
+
+} // namespace detail
+
+//-------------------------------------------------------------------------------------------------
+
+void dump(std::ostream& stream)
+{
+    stream << "{\"functions\": [";
+
+    bool first = true;
+    const size_t classCount = ponder::classCount();
+    for (size_t c = 0; c < classCount; ++c)
+    {
+        const Class& metaclass = *ponder::classByIndex(c);
+        const size_t functionCount = metaclass.functionCount();
+        for (size_t f = 0; f < functionCount; ++f)
+        {
+            const Function& function = metaclass.function(f);
+            const FunctionStats stats = function.stats();
+            if (stats.calls == 0)
+                continue;
+
+            stream << (first ? "\n  {\"class\": " : ",\n  {\"class\": ");
+            writeString(stream, metaclass.name().data(), metaclass.name().size());
+            stream << ", \"function\": ";
+            writeString(stream, function.name().data(), function.name().size());
+            stream << ", \"calls\": " << stats.calls
+                   << ", \"exceptions\": " << stats.exceptions
+                   << ", \"totalNs\": " << stats.totalNs
+                   << ", \"meanNs\": " << stats.meanNs()
+                   << ", \"p50Ns\": " << stats.latency.percentile(50)
+                   << ", \"p90Ns\": " << stats.latency.percentile(90)
+                   << ", \"p99Ns\": " << stats.latency.percentile(99)
+                   << ", \"p999Ns\": " << stats.latency.percentile(99.9)
+                   << ", \"maxNs\": " << stats.latency.percentile(100)
+                   << "}";
+            first = false;
+        }
+    }
+
+    stream << (first ? "]}\n" : "\n]}\n");
+}
+
+} // namespace profiling
+} // namespace ponder
@@ -76,6 +76,41 @@ void Property::set(const UserObject& object, const Value& value) const
     object.set(*this, value);
 }
 
+Expected<Value> Property::tryGet(const UserObject& object) const
+{
+    if (!isReadable())
+        return ErrorCode::ForbiddenRead;
+
+    const ErrorCode error = checkAccess(object, nullptr);
+    if (error != ErrorCode::None)
+        return error;
+
+    return getValue(object);
+}
+
+Expected<void> Property::trySet(const UserObject& object, const Value& value) const
+{
+    if (!isWritable())
+        return ErrorCode::ForbiddenWrite;
+
+    const ErrorCode error = checkAccess(object, &value);
+    if (error != ErrorCode::None)
+        return error;
+
+    object.set(*this, value);
+    return {};
+}
+
+const void* Property::typedAccess(TypeId) const
+{
+    return nullptr;
+}
+
+ErrorCode Property::checkAccess(const UserObject& object, const Value*) const
+{
+    return object.pointer() ? ErrorCode::None : ErrorCode::NullObject;
+}
+
 void Property::accept(ClassVisitor& visitor) const
 {
     visitor.visit(*this);
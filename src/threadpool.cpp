@@ -0,0 +1,254 @@
+/****************************************************************************
+**
+** This file is part of the Ponder library, formerly CAMP.
+**
+** The MIT License (MIT)
+**
+** Copyright (C) 2009-2014 TEGESO/TEGESOFT and/or its subsidiary(-ies) and mother company.
+** Copyright (C) 2015-2020 Nick Trout.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a copy
+** of this software and associated documentation files (the "Software"), to deal
+** in the Software without restriction, including without limitation the rights
+** to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+** copies of the Software, and to permit persons to whom the Software is
+** furnished to do so, subject to the following conditions:
+** 
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+** 
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+** OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+** THE SOFTWARE.
+**
+****************************************************************************/
+
+#include <ponder/threadpool.hpp>
+#include <algorithm>
+#include <deque>
+#include <exception>
+
+namespace ponder {
+namespace parallel {
+
+namespace {
+
+// Worker of the current thread, if it is one.
+thread_local const ThreadPool* t_pool = nullptr;
+thread_local size_t t_worker = 0;
+
+// Shards per thread, so that threads finishing early can steal work.
+constexpr size_t c_shardsPerThread = 4;
+
+} // namespace
+
+struct ThreadPool::Queue
+{
+    std::mutex mutex;
+    std::deque<Task> tasks; // Owner pops the back, thieves the front
+};
+
+ThreadPool::ThreadPool(size_t workerCount)
+    : m_pending(0)
+    , m_nextQueue(0)
+    , m_stop(false)
+{
+    for (size_t i = 0; i < workerCount; ++i)
+        m_queues.emplace_back(new Queue);
+
+    m_threads.reserve(workerCount);
+    for (size_t i = 0; i < workerCount; ++i)
+        m_threads.emplace_back(&ThreadPool::workerLoop, this, i);
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_wake.notify_all();
+
+    for (std::thread& thread : m_threads)
+        thread.join();
+}
+
+void ThreadPool::submit(Task task)
+{
+    if (m_queues.empty())
+    {
+        task();
+        return;
+    }
+
+    // Workers queue their own tasks, others are spread over the workers
+    const size_t index = t_pool == this
+                       ? t_worker
+                       : m_nextQueue.fetch_add(1, std::memory_order_relaxed) % m_queues.size();
+    {
+        Queue& queue = *m_queues[index];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back(std::move(task));
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_pending;
+    }
+    m_wake.notify_one();
+}
+
+bool ThreadPool::runPendingTask()
+{
+    if (m_queues.empty())
+        return false;
+
+    Task task;
+    if (!popTask(t_pool == this ? t_worker : 0, task))
+        return false;
+
+    task();
+    return true;
+}
+
+bool ThreadPool::popTask(size_t index, Task& task)
+{
+    // Own queue first, newest task
+    {
+        Queue& queue = *m_queues[index];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.tasks.empty())
+        {
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+            --m_pending;
+            return true;
+        }
+    }
+
+    // Steal the oldest task of another queue
+    for (size_t i = 1; i < m_queues.size(); ++i)
+    {
+        Queue& queue = *m_queues[(index + i) % m_queues.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.tasks.empty())
+        {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+            --m_pending;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void ThreadPool::workerLoop(size_t index)
+{
+    t_pool = this;
+    t_worker = index;
+
+    Task task;
+    for (;;)
+    {
+        if (popTask(index, task))
+        {
+            task();
+            task = nullptr;
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_wake.wait(lock, [this] {return m_stop || m_pending > 0;});
+        if (m_stop && m_pending <= 0)
+            return;
+    }
+}
+
+void ThreadPool::forRange(size_t count, size_t grain, const RangeBody& body)
+{
+    if (count == 0)
+        return;
+
+    const size_t maxShards = (m_threads.size() + 1) * c_shardsPerThread;
+    const size_t shardCount = std::min(maxShards, std::max<size_t>(count / std::max<size_t>(grain, 1), 1));
+    if (shardCount == 1 || m_threads.empty())
+    {
+        body(0, count);
+        return;
+    }
+
+    // Shared by the shards, lives until they are all complete
+    struct Loop
+    {
+        std::mutex mutex;
+        std::condition_variable done;
+        size_t remaining;
+        std::atomic<bool> failed{false};
+        std::exception_ptr error;
+    } loop;
+    loop.remaining = shardCount;
+
+    const auto runShard = [&loop, &body](size_t begin, size_t end)
+    {
+        if (!loop.failed.load(std::memory_order_relaxed))
+        {
+#if PONDER_EXCEPTIONS
+            try
+            {
+                body(begin, end);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(loop.mutex);
+                if (!loop.error)
+                    loop.error = std::current_exception();
+                loop.failed = true;
+            }
+#else
+            body(begin, end);
+#endif
+        }
+
+        // The loop is released once this is unlocked, it must not be used after
+        std::lock_guard<std::mutex> lock(loop.mutex);
+        if (--loop.remaining == 0)
+            loop.done.notify_all();
+    };
+
+    // Queue all shards but the first, which this thread runs
+    const size_t shardSize = count / shardCount, extra = count % shardCount;
+    size_t begin = shardSize + (extra > 0 ? 1 : 0);
+    const size_t firstEnd = begin;
+    for (size_t s = 1; s < shardCount; ++s)
+    {
+        const size_t end = begin + shardSize + (s < extra ? 1 : 0);
+        submit([runShard, begin, end] {runShard(begin, end);});
+        begin = end;
+    }
+    runShard(0, firstEnd);
+
+    // Help with the pending tasks, then wait for the shards run by others
+    while (runPendingTask())
+    {
+    }
+    {
+        std::unique_lock<std::mutex> lock(loop.mutex);
+        loop.done.wait(lock, [&loop] {return loop.remaining == 0;});
+    }
+
+    if (loop.error)
+        std::rethrow_exception(loop.error);
+}
+
+ThreadPool& ThreadPool::defaultPool()
+{
+    static ThreadPool pool(std::max(std::thread::hardware_concurrency(), 2u) - 1);
+    return pool;
+}
+
+} // namespace parallel
+} // namespace ponder
@@ -28,6 +28,7 @@
 
 #include <ponder/userdata.hpp>
 #include <ponder/detail/dictionary.hpp>
+#include <unordered_map>
 
 namespace ponder {
     
@@ -35,7 +36,7 @@ class TypeUserDataStore : public IUserDataStore
 {
     typedef const Type* key_t;
     typedef detail::Dictionary<Id, IdRef, Value> store_t;
-    typedef std::map<key_t, store_t> class_store_t;
+    typedef std::unordered_map<key_t, store_t> class_store_t;
     class_store_t m_store;
     
 public:
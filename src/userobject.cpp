@@ -35,41 +35,57 @@ namespace ponder {
     
 const UserObject UserObject::nothing;
 
+std::pmr::memory_resource* UserObject::memoryResource(const Class& cls)
+{
+    return cls.memoryResource();
+}
+
 UserObject::UserObject()
     : m_class(nullptr)
+    , m_pointer(nullptr)
     , m_holder()
+    , m_storage(Storage::None)
 {
 }
 
 UserObject::UserObject(const UserObject& other)
     : m_class(other.m_class)
+    , m_pointer(other.m_pointer)
     , m_holder(other.m_holder)
+    , m_storage(other.m_storage)
 {
 }
 
 UserObject::UserObject(UserObject&& other) noexcept
+    : UserObject()
 {
     std::swap(m_class, other.m_class);
+    std::swap(m_pointer, other.m_pointer);
     m_holder.swap(other.m_holder);
+    std::swap(m_storage, other.m_storage);
 }
 
 UserObject& UserObject::operator = (const UserObject& other)
 {
     m_class = other.m_class;
+    m_pointer = other.m_pointer;
     m_holder = other.m_holder;
+    m_storage = other.m_storage;
     return *this;
 }
 
 UserObject& UserObject::operator = (UserObject&& other) noexcept
 {
     std::swap(m_class, other.m_class);
+    std::swap(m_pointer, other.m_pointer);
     m_holder.swap(other.m_holder);
+    std::swap(m_storage, other.m_storage);
     return *this;
 }
 
 void* UserObject::pointer() const
 {
-    return m_holder != nullptr ? m_holder->object() : nullptr;
+    return m_pointer;
 }
 
 const Class& UserObject::getClass() const
@@ -94,6 +110,16 @@ Value UserObject::get(size_t index) const
     return getClass().property(index).get(*this);
 }
 
+Value UserObject::get(PropertyHandle handle) const
+{
+    return getClass().property(handle).get(*this);
+}
+
+Value UserObject::get(HashedId property) const
+{
+    return getClass().property(property).get(*this);
+}
+
 void UserObject::set(IdRef property, const Value& value) const
 {
     getClass().property(property).set(*this, value);
@@ -104,11 +130,61 @@ void UserObject::set(size_t index, const Value& value) const
     getClass().property(index).set(*this, value);
 }
 
+void UserObject::set(PropertyHandle handle, const Value& value) const
+{
+    getClass().property(handle).set(*this, value);
+}
+
+void UserObject::set(HashedId property, const Value& value) const
+{
+    getClass().property(property).set(*this, value);
+}
+
+Expected<Value> UserObject::tryGet(IdRef property) const
+{
+    const Property* prop;
+    if (!m_class)
+        return ErrorCode::NullObject;
+    if (!m_class->tryProperty(property, prop))
+        return ErrorCode::PropertyNotFound;
+    return prop->tryGet(*this);
+}
+
+Expected<Value> UserObject::tryGet(HashedId property) const
+{
+    const Property* prop;
+    if (!m_class)
+        return ErrorCode::NullObject;
+    if (!m_class->tryProperty(property, prop))
+        return ErrorCode::PropertyNotFound;
+    return prop->tryGet(*this);
+}
+
+Expected<void> UserObject::trySet(IdRef property, const Value& value) const
+{
+    const Property* prop;
+    if (!m_class)
+        return ErrorCode::NullObject;
+    if (!m_class->tryProperty(property, prop))
+        return ErrorCode::PropertyNotFound;
+    return prop->trySet(*this, value);
+}
+
+Expected<void> UserObject::trySet(HashedId property, const Value& value) const
+{
+    const Property* prop;
+    if (!m_class)
+        return ErrorCode::NullObject;
+    if (!m_class->tryProperty(property, prop))
+        return ErrorCode::PropertyNotFound;
+    return prop->trySet(*this, value);
+}
+
 bool UserObject::operator == (const UserObject& other) const
 {
-    if (m_holder && other.m_holder)
+    if (m_pointer && other.m_pointer)
     {
-        return m_holder->object() == other.m_holder->object();
+        return m_pointer == other.m_pointer;
     }
     else if (!m_class && !other.m_class)
     {
@@ -120,21 +196,43 @@ bool UserObject::operator == (const UserObject& other) const
 
 bool UserObject::operator < (const UserObject& other) const
 {
-    if (m_holder)
+    if (m_pointer)
     {
-        if (other.m_holder)
+        if (other.m_pointer)
         {
-            return m_holder->object() < other.m_holder->object();
+            return m_pointer < other.m_pointer;
         }
     }
     assert(0);
     return false;
 }
 
+void UserObject::detach() const
+{
+    // Copy on write objects were made by copying, so they can always be copied again.
+    std::shared_ptr<detail::AbstractObjectHolder> copy = m_holder->clone(memoryResource(*m_class));
+    assert(copy);
+
+    m_pointer = copy->object();
+    m_holder = std::move(copy);
+}
+
+UserObject UserObject::writableRef() const
+{
+    if (!m_pointer)
+        return *this;
+
+    makeWritable();
+    return UserObject(m_class, m_pointer,
+                      m_storage == Storage::ConstRef ? Storage::ConstRef : Storage::Ref);
+}
+
 void UserObject::set(const Property& property, const Value& value) const
 {
-    if (m_holder)
+    if (m_pointer)
     {
+        makeWritable();
+
         // Just forward to the property, no extra processing required
         property.setValue(*this, value);
     }
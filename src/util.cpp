@@ -28,6 +28,8 @@
  ****************************************************************************/
 
 #include <ponder/detail/util.hpp>
+#include <cerrno>
+#include <cstdlib>
 
 #if defined(__GNUWIN32__) && __cplusplus >= 201103L
     // MinGW support using C++11 defines __STRICT_ANSI__ which removes strcasecmp
@@ -61,16 +63,28 @@ static inline int stricmp(const char* a, const char* b)
 
 // parse string
 
+// Parse a number as std::stol() and friends do, but report failures rather than throw, so
+// that conversion errors are cheap.
+template <typename T, typename P>
+static bool parse_number(const String& from, T& to, P parser)
+{
+    const char* str = from.c_str();
+    char* end = nullptr;
+    const int savedErrno = errno;
+    errno = 0;
+    const auto value = parser(str, &end);
+    const bool parsed = end != str && errno != ERANGE;
+    if (errno == 0)
+        errno = savedErrno;
+    if (parsed)
+        to = static_cast<T>(value);
+    return parsed;
+}
+
 template <typename T>
 static bool parse_integer(const String& from, T& to)
 {
-    try {
-        const long p = std::stol(from.c_str(), nullptr, 0);
-        to = static_cast<T>(p);
-    } catch (std::logic_error&) {
-        return false;
-    }
-    return true;
+    return parse_number(from, to, [](const char* s, char** e) {return std::strtol(s, e, 0);});
 }
 
 bool conv(const String& from, char& to)
@@ -124,22 +138,12 @@ bool conv(const String& from, unsigned long& to)
 
 bool conv(const String& from, long long& to)
 {
-    try {
-        to = std::stoll(from.c_str(), nullptr, 0);
-    } catch (std::logic_error&) {
-        return false;
-    }
-    return true;
+    return parse_number(from, to, [](const char* s, char** e) {return std::strtoll(s, e, 0);});
 }
 
 bool conv(const String& from, unsigned long long& to)
 {
-    try {
-        to = std::stoull(from.c_str(), nullptr, 0);
-    } catch (std::logic_error&) {
-        return false;
-    }
-    return true;
+    return parse_number(from, to, [](const char* s, char** e) {return std::strtoull(s, e, 0);});
 }
 
 bool conv(const String& from, bool& to)
@@ -160,22 +164,12 @@ bool conv(const String& from, bool& to)
 
 bool conv(const String& from, float& to)
 {
-    try {
-        to = std::stof(from.c_str());
-    } catch (std::logic_error&) {
-        return false;
-    }
-    return true;
+    return parse_number(from, to, [](const char* s, char** e) {return std::strtof(s, e);});
 }
 
 bool conv(const String& from, double& to)
 {
-    try {
-        to = std::stod(from.c_str());
-    } catch (std::logic_error&) {
-        return false;
-    }
-    return true;
+    return parse_number(from, to, [](const char* s, char** e) {return std::strtod(s, e);});
 }
 
 
@@ -56,6 +56,12 @@ void Value::operator = (const Value& other)
     m_value = other.m_value;
     m_type = other.m_type;
 }
+
+void Value::operator = (Value&& other)
+{
+    std::swap(m_value, other.m_value);
+    std::swap(m_type, other.m_type);
+}
     
 ValueKind Value::kind() const
 {
@@ -0,0 +1,152 @@
+/****************************************************************************
+**
+** This file is part of the Ponder library, formerly CAMP.
+**
+** The MIT License (MIT)
+**
+** Copyright (C) 2015-2020 Nick Trout.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a copy
+** of this software and associated documentation files (the "Software"), to deal
+** in the Software without restriction, including without limitation the rights
+** to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+** copies of the Software, and to permit persons to whom the Software is
+** furnished to do so, subject to the following conditions:
+** 
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+** 
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+** OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+** THE SOFTWARE.
+**
+****************************************************************************/
+
+// Benchmarks for casting pointers through deep class hierarchies.
+
+#include <ponder/classbuilder.hpp>
+#include "perf.hpp"
+#include <string>
+
+namespace ClassCastPerf
+{
+    // Every level adds a base before the previous level, so each cast needs an offset.
+    template <int N>
+    struct Pad
+    {
+        int pad[N + 1];
+    };
+
+    template <int N>
+    struct Level : Pad<N>, Level<N - 1>
+    {
+    };
+
+    template <>
+    struct Level<0>
+    {
+        int x = 0;
+    };
+
+    static constexpr int c_depth = 8;
+
+    template <int N>
+    void declareLevel()
+    {
+        if constexpr (N > 0)
+        {
+            declareLevel<N - 1>();
+            ponder::Class::declare<Pad<N>>("Pad" + std::to_string(N));
+            ponder::Class::declare<Level<N>>("Level" + std::to_string(N))
+                .template base<Pad<N>>()
+                .template base<Level<N - 1>>();
+        }
+        else
+        {
+            ponder::Class::declare<Level<0>>("Level0")
+                .property("x", &Level<0>::x);
+        }
+    }
+}
+
+// Register the synthetic hierarchy types.
+namespace ponder {
+namespace detail {
+template <int N>
+struct StaticTypeDecl<ClassCastPerf::Level<N>>
+{
+    static TypeId id(bool = true) {return calcTypeId<ClassCastPerf::Level<N>>();}
+    static const char* name(bool = true) {return "ClassCastPerf::Level";}
+    static constexpr bool defined = true, copyable = true;
+};
+template <int N>
+struct StaticTypeDecl<ClassCastPerf::Pad<N>>
+{
+    static TypeId id(bool = true) {return calcTypeId<ClassCastPerf::Pad<N>>();}
+    static const char* name(bool = true) {return "ClassCastPerf::Pad";}
+    static constexpr bool defined = true, copyable = true;
+};
+}}
+
+using namespace ClassCastPerf;
+
+namespace {
+
+struct Hierarchy
+{
+    Hierarchy() { declareLevel<c_depth>(); }
+    ~Hierarchy() { undeclareLevel<c_depth>(); }
+
+    template <int N>
+    static void undeclareLevel()
+    {
+        ponder::Class::undeclare<Level<N>>();
+        if constexpr (N > 0)
+        {
+            ponder::Class::undeclare<Pad<N>>();
+            undeclareLevel<N - 1>();
+        }
+    }
+};
+
+}
+
+TEST_CASE("Pointers can be cast through deep hierarchies")
+{
+    Hierarchy hierarchy;
+    Level<c_depth> object;
+    Level<0>* root = &object;
+    const ponder::Class& leafClass = ponder::classByType<Level<c_depth>>();
+    const ponder::Class& rootClass = ponder::classByType<Level<0>>();
+
+    REQUIRE(ponder::classCast(&object, leafClass, rootClass) == root);
+    REQUIRE(ponder::classCast(root, rootClass, leafClass) == &object);
+}
+
+TEST_CASE("Class cast cost in deep hierarchies", PERF_TAG)
+{
+    Hierarchy hierarchy;
+    Level<c_depth> object;
+    Level<0>* root = &object;
+    const ponder::Class& leafClass = ponder::classByType<Level<c_depth>>();
+    const ponder::Class& rootClass = ponder::classByType<Level<0>>();
+
+    BENCHMARK("classCast, up 8 levels")
+    {
+        return ponder::classCast(&object, leafClass, rootClass);
+    };
+
+    BENCHMARK("classCast, down 8 levels")
+    {
+        return ponder::classCast(root, rootClass, leafClass);
+    };
+
+    BENCHMARK("isA, 8 levels")
+    {
+        return leafClass.isA(rootClass);
+    };
+}
@@ -0,0 +1,127 @@
+/****************************************************************************
+**
+** This file is part of the Ponder library, formerly CAMP.
+**
+** The MIT License (MIT)
+**
+** Copyright (C) 2015-2020 Nick Trout.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a copy
+** of this software and associated documentation files (the "Software"), to deal
+** in the Software without restriction, including without limitation the rights
+** to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+** copies of the Software, and to permit persons to whom the Software is
+** furnished to do so, subject to the following conditions:
+** 
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+** 
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+** OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+** THE SOFTWARE.
+**
+****************************************************************************/
+
+// Benchmarks for metaclass lookup as the number of registered classes grows.
+
+#include <ponder/classbuilder.hpp>
+#include <ponder/enum.hpp>
+#include "perf.hpp"
+#include <vector>
+
+namespace ClassManagerPerf
+{
+    // Number of classes registered at each stage of the benchmark.
+    constexpr size_t c_stage1 = 16, c_stage2 = 128, c_stage3 = 512;
+
+    std::string synthName(size_t n)
+    {
+        return "perf::Synthetic" + std::to_string(n);
+    }
+
+    // Type ids of the synthetic types. Only the ids are instantiated, the classes are added
+    // to the manager directly, as Class::declare() would, without a ClassBuilder per type.
+    struct CollectId
+    {
+        static std::vector<ponder::TypeId>& ids()
+        {
+            static std::vector<ponder::TypeId> v;
+            return v;
+        }
+
+        template <size_t I>
+        static void apply()
+        {
+            ids().push_back(ponder::detail::calcTypeId<perf::Synthetic<I>>());
+        }
+    };
+
+    void declareRange(size_t from, size_t to)
+    {
+        if (CollectId::ids().empty())
+            perf::forEachIndex<CollectId>(PONDER__SEQNS::make_index_sequence<c_stage3>());
+
+        auto& manager = ponder::detail::ClassManager::instance();
+        for (size_t i = from; i < to; ++i)
+            manager.addClass(CollectId::ids()[i], synthName(i));
+    }
+
+    // Stages are cumulative so that the same classes are looked up as the table grows.
+    void declareStage(int stage)
+    {
+        static int declared = 0;
+        if (declared < 1 && stage >= 1) declareRange(0, c_stage1);
+        if (declared < 2 && stage >= 2) declareRange(c_stage1, c_stage2);
+        if (declared < 3 && stage >= 3) declareRange(c_stage2, c_stage3);
+        if (stage > declared)
+            declared = stage;
+    }
+}
+
+using namespace ClassManagerPerf;
+
+TEST_CASE("Class name lookup finds classes in large registries")
+{
+    declareStage(3);
+
+    for (size_t i = 0; i < c_stage3; i += 97)
+    {
+        const ponder::Class& cls = ponder::classByName(synthName(i));
+        REQUIRE(cls.name() == synthName(i));
+    }
+
+    REQUIRE_THROWS_AS(ponder::classByName("perf::NotDeclared"), ponder::ClassNotFound);
+}
+
+TEST_CASE("Class name lookup cost as registry grows", PERF_TAG)
+{
+    // The name looked up is the same at each stage, only the registry size changes.
+    const std::string first = synthName(0), last = synthName(c_stage1 - 1);
+
+    declareStage(1);
+    BENCHMARK("classByName, 16 classes")
+    {
+        return &ponder::classByName(last);
+    };
+
+    declareStage(2);
+    BENCHMARK("classByName, 128 classes")
+    {
+        return &ponder::classByName(last);
+    };
+
+    declareStage(3);
+    BENCHMARK("classByName, 512 classes")
+    {
+        return &ponder::classByName(last);
+    };
+
+    BENCHMARK("classByName, 512 classes, miss")
+    {
+        return ponder::detail::ClassManager::instance().getByNameSafe("perf::NotDeclared");
+    };
+}
@@ -0,0 +1,118 @@
+/****************************************************************************
+**
+** This file is part of the Ponder library, formerly CAMP.
+**
+** The MIT License (MIT)
+**
+** Copyright (C) 2015-2020 Nick Trout.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a copy
+** of this software and associated documentation files (the "Software"), to deal
+** in the Software without restriction, including without limitation the rights
+** to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+** copies of the Software, and to permit persons to whom the Software is
+** furnished to do so, subject to the following conditions:
+** 
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+** 
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+** OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+** THE SOFTWARE.
+**
+****************************************************************************/
+
+
+// Benchmarks for constructing objects through the runtime, with overloaded constructors.
+
+#include <ponder/classbuilder.hpp>
+#include <ponder/uses/runtime.hpp>
+#include "perf.hpp"
+
+namespace ConstructorPerf
+{
+    struct Colour
+    {
+        float r = 0, g = 0, b = 0;
+    };
+
+    struct Material
+    {
+        Material() {}
+        Material(int i) : index(i) {}
+        Material(const ponder::String& n) : name(n) {}
+        Material(float s) : shininess(s) {}
+        Material(const Colour& c) : colour(c) {}
+        Material(const Colour& c, float s) : colour(c), shininess(s) {}
+        Material(const Colour& c, const ponder::String& n) : name(n), colour(c) {}
+
+        int index = 0;
+        ponder::String name;
+        Colour colour;
+        float shininess = 0;
+    };
+
+    void declare()
+    {
+        ponder::Class::declare<Colour>();
+
+        ponder::Class::declare<Material>()
+            .constructor()
+            .constructor<int>()
+            .constructor<ponder::String>()
+            .constructor<float>()
+            .constructor<Colour>()
+            .constructor<Colour, float>()
+            .constructor<Colour, ponder::String>();
+    }
+}
+
+PONDER_AUTO_TYPE(ConstructorPerf::Colour, &ConstructorPerf::declare)
+PONDER_AUTO_TYPE(ConstructorPerf::Material, &ConstructorPerf::declare)
+
+using namespace ConstructorPerf;
+
+TEST_CASE("Overloaded constructors are resolved")
+{
+    const ponder::Class& metaclass = ponder::classByType<Material>();
+    ponder::runtime::ObjectFactory factory(metaclass);
+    Colour colour;
+
+    ponder::UserObject object = factory.construct(ponder::Args(colour, "metal"));
+    REQUIRE(object.get<Material>().name == "metal");
+}
+
+TEST_CASE("Constructor resolution cost", PERF_TAG)
+{
+    const ponder::Class& metaclass = ponder::classByType<Material>();
+    ponder::runtime::ObjectFactory factory(metaclass);
+    const ponder::Args args(Colour(), "metal");
+    alignas(Material) unsigned char storage[sizeof(Material)];
+
+    BENCHMARK("match each constructor")
+    {
+        // Resolution as done before it was cached
+        for (size_t i = 0, nb = metaclass.constructorCount(); i < nb; ++i)
+        {
+            if (metaclass.constructor(i)->matches(args))
+                return metaclass.constructor(i);
+        }
+        return static_cast<const ponder::Constructor*>(nullptr);
+    };
+
+    BENCHMARK("find constructor")
+    {
+        return metaclass.findConstructor(args);
+    };
+
+    BENCHMARK("construct with placement new")
+    {
+        ponder::UserObject object = factory.construct(args, storage);
+        factory.destruct(object);
+        return object;
+    };
+}
@@ -0,0 +1,113 @@
+/****************************************************************************
+**
+** This file is part of the Ponder library, formerly CAMP.
+**
+** The MIT License (MIT)
+**
+** Copyright (C) 2015-2020 Nick Trout.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a copy
+** of this software and associated documentation files (the "Software"), to deal
+** in the Software without restriction, including without limitation the rights
+** to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+** copies of the Software, and to permit persons to whom the Software is
+** furnished to do so, subject to the following conditions:
+** 
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+** 
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+** OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+** THE SOFTWARE.
+**
+****************************************************************************/
+
+// Benchmarks for converting enum values to and from names.
+
+#include <ponder/enum.hpp>
+#include <ponder/value.hpp>
+#include "perf.hpp"
+
+namespace EnumPerf
+{
+    enum Dense
+    {
+        D0, D1, D2, D3, D4, D5, D6, D7, D8, D9, D10, D11, D12, D13, D14, D15,
+        D16, D17, D18, D19, D20, D21, D22, D23, D24, D25, D26, D27, D28, D29, D30, D31
+    };
+
+    enum Sparse
+    {
+        S0 = 1, S1 = 1 << 4, S2 = 1 << 8, S3 = 1 << 12, S4 = 1 << 16, S5 = 1 << 20,
+        S6 = 1 << 24, S7 = 1 << 28
+    };
+
+    void declare()
+    {
+        static const char* names[] = {
+            "d0", "d1", "d2", "d3", "d4", "d5", "d6", "d7", "d8", "d9", "d10", "d11", "d12",
+            "d13", "d14", "d15", "d16", "d17", "d18", "d19", "d20", "d21", "d22", "d23", "d24",
+            "d25", "d26", "d27", "d28", "d29", "d30", "d31"
+        };
+        {
+            ponder::EnumBuilder dense = ponder::Enum::declare<Dense>();
+            for (int i = 0; i < 32; ++i)
+                dense.value(names[i], static_cast<Dense>(i));
+        }
+        {
+            ponder::EnumBuilder sparse = ponder::Enum::declare<Sparse>();
+            for (int i = 0; i < 8; ++i)
+                sparse.value(names[i], static_cast<Sparse>(1 << (4 * i)));
+        }
+    }
+}
+
+PONDER_AUTO_TYPE(EnumPerf::Dense, &EnumPerf::declare)
+PONDER_AUTO_TYPE(EnumPerf::Sparse, &EnumPerf::declare)
+
+using namespace EnumPerf;
+
+TEST_CASE("Enum values convert to and from names")
+{
+    REQUIRE(ponder::enumByType<Dense>().name(D31) == "d31");
+    REQUIRE(ponder::enumByType<Sparse>().name(S7) == "d7");
+    REQUIRE(ponder::Value(D20).to<ponder::String>() == "d20");
+    REQUIRE(ponder::Value("d20").to<Dense>() == D20);
+}
+
+TEST_CASE("Enum name conversion cost", PERF_TAG)
+{
+    const ponder::Enum& dense = ponder::enumByType<Dense>();
+    const ponder::Enum& sparse = ponder::enumByType<Sparse>();
+    const ponder::Value value(D31);
+    const ponder::Value name("d31");
+
+    BENCHMARK("name(value), dense")
+    {
+        return dense.name(D31);
+    };
+
+    BENCHMARK("name(value), sparse")
+    {
+        return sparse.name(S7);
+    };
+
+    BENCHMARK("value(name)")
+    {
+        return dense.value("d31");
+    };
+
+    BENCHMARK("enum Value to string")
+    {
+        return value.to<ponder::String>();
+    };
+
+    BENCHMARK("string Value to enum")
+    {
+        return name.to<Dense>();
+    };
+}
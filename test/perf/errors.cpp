@@ -0,0 +1,142 @@
+/****************************************************************************
+**
+** This file is part of the Ponder library, formerly CAMP.
+**
+** The MIT License (MIT)
+**
+** Copyright (C) 2015-2020 Nick Trout.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a copy
+** of this software and associated documentation files (the "Software"), to deal
+** in the Software without restriction, including without limitation the rights
+** to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+** copies of the Software, and to permit persons to whom the Software is
+** furnished to do so, subject to the following conditions:
+** 
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+** 
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+** OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+** THE SOFTWARE.
+**
+****************************************************************************/
+
+
+// Benchmarks for reporting errors: throwing and catching them, compared to the try*
+// functions returning an error code.
+
+#include <ponder/classbuilder.hpp>
+#include <ponder/uses/runtime.hpp>
+#include "perf.hpp"
+
+namespace ErrorsPerf
+{
+    struct Counter
+    {
+        int count = 0;
+
+        int add(int n) {return count += n;}
+    };
+
+    void declare()
+    {
+        ponder::Class::declare<Counter>()
+            .property("count", &Counter::count)
+            .function("add", &Counter::add);
+    }
+}
+
+PONDER_AUTO_TYPE(ErrorsPerf::Counter, &ErrorsPerf::declare)
+
+using namespace ErrorsPerf;
+
+TEST_CASE("Throwing and non-throwing errors agree")
+{
+    Counter counter;
+    const ponder::UserObject object(&counter);
+    const ponder::Function& add = ponder::classByType<Counter>().function("add");
+
+    REQUIRE_THROWS_AS(ponder::Value("abc").to<int>(), ponder::BadType);
+    REQUIRE((ponder::Value("abc").tryTo<int>().error() == ponder::ErrorCode::BadType));
+    REQUIRE_THROWS_AS(object.get("missing"), ponder::PropertyNotFound);
+    REQUIRE((object.tryGet("missing").error() == ponder::ErrorCode::PropertyNotFound));
+    REQUIRE_THROWS_AS(ponder::runtime::call(add, object, "abc"), ponder::BadArgument);
+    REQUIRE((ponder::runtime::tryCall(add, object, "abc").error()
+             == ponder::ErrorCode::BadArgument));
+}
+
+TEST_CASE("Error reporting overhead", PERF_TAG)
+{
+    Counter counter;
+    const ponder::UserObject object(&counter);
+    const ponder::Function& add = ponder::classByType<Counter>().function("add");
+    const ponder::Value bad("abc");
+
+    BENCHMARK("to, bad conversion caught")
+    {
+        try
+        {
+            return bad.to<int>();
+        }
+        catch (const ponder::BadType&)
+        {
+            return -1;
+        }
+    };
+
+    BENCHMARK("tryTo, bad conversion")
+    {
+        return bad.tryTo<int>().valueOr(-1);
+    };
+
+    BENCHMARK("get, missing property caught")
+    {
+        try
+        {
+            return object.get("missing");
+        }
+        catch (const ponder::PropertyNotFound&)
+        {
+            return ponder::Value::nothing;
+        }
+    };
+
+    BENCHMARK("tryGet, missing property")
+    {
+        return object.tryGet("missing").valueOr(ponder::Value::nothing);
+    };
+
+    BENCHMARK("call, bad argument caught")
+    {
+        try
+        {
+            return ponder::runtime::call(add, object, bad);
+        }
+        catch (const ponder::BadArgument&)
+        {
+            return ponder::Value::nothing;
+        }
+    };
+
+    BENCHMARK("tryCall, bad argument")
+    {
+        return ponder::runtime::tryCall(add, object, bad).valueOr(ponder::Value::nothing);
+    };
+
+    int i = 0;
+
+    BENCHMARK("call, success")
+    {
+        return ponder::runtime::call(add, object, ++i);
+    };
+
+    BENCHMARK("tryCall, success")
+    {
+        return ponder::runtime::tryCall(add, object, ++i).valueOr(ponder::Value::nothing);
+    };
+}
@@ -0,0 +1,156 @@
+/****************************************************************************
+**
+** This file is part of the Ponder library, formerly CAMP.
+**
+** The MIT License (MIT)
+**
+** Copyright (C) 2015-2020 Nick Trout.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a copy
+** of this software and associated documentation files (the "Software"), to deal
+** in the Software without restriction, including without limitation the rights
+** to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+** copies of the Software, and to permit persons to whom the Software is
+** furnished to do so, subject to the following conditions:
+** 
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+** 
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+** OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+** THE SOFTWARE.
+**
+****************************************************************************/
+
+// Benchmarks for calling functions through the runtime, compared to a direct call.
+
+#include <ponder/classbuilder.hpp>
+#include <ponder/uses/async.hpp>
+#include "perf.hpp"
+
+namespace FunctionPerf
+{
+    struct Counter
+    {
+        int count = 0;
+
+        int add(int n) {return count += n;}
+    };
+
+    void declare()
+    {
+        ponder::Class::declare<Counter>()
+            .function("add", &Counter::add)
+            .function<&Counter::add>("staticAdd")
+            .function("wrappedAdd", std::function<int(Counter&, int)>(&Counter::add));
+    }
+}
+
+PONDER_AUTO_TYPE(FunctionPerf::Counter, &FunctionPerf::declare)
+
+using namespace FunctionPerf;
+
+TEST_CASE("Functions declared in different ways give the same result")
+{
+    const ponder::Class& metaclass = ponder::classByType<Counter>();
+    Counter counter;
+
+    ponder::runtime::call(metaclass.function("add"), &counter, 2);
+    ponder::runtime::call(metaclass.function("staticAdd"), &counter, 2);
+    ponder::runtime::callStatic(metaclass.function("wrappedAdd"), &counter, 2);
+    ponder::runtime::TypedCaller<int(Counter&, int)>(metaclass.function("add"))(counter, 2);
+
+    REQUIRE(counter.count == 8);
+}
+
+TEST_CASE("Function call overhead", PERF_TAG)
+{
+    const ponder::Class& metaclass = ponder::classByType<Counter>();
+    Counter counter;
+    const ponder::UserObject object(&counter);
+    ponder::runtime::ObjectCaller add(metaclass.function("add"));
+    ponder::runtime::ObjectCaller staticAdd(metaclass.function("staticAdd"));
+    ponder::runtime::FunctionCaller wrappedAdd(metaclass.function("wrappedAdd"));
+    ponder::runtime::TypedCaller<int(Counter&, int)> typedAdd(metaclass.function("staticAdd"));
+    int i = 0;
+
+    BENCHMARK("direct call")
+    {
+        return counter.add(++i);
+    };
+
+    BENCHMARK("runtime call, member pointer")
+    {
+        return add.call(object, ++i);
+    };
+
+    BENCHMARK("runtime call, template argument")
+    {
+        return staticAdd.call(object, ++i);
+    };
+
+    BENCHMARK("runtime call, std::function")
+    {
+        return wrappedAdd.call(ponder::Args(object, ++i)); // object is the first argument
+    };
+
+    BENCHMARK("typed call")
+    {
+        return typedAdd(counter, ++i);
+    };
+}
+
+TEST_CASE("Batched call overhead", PERF_TAG)
+{
+    const ponder::Function& add = ponder::classByType<Counter>().function("add");
+    std::vector<Counter> counters(1000);
+    std::vector<ponder::UserObject> objects;
+    for (Counter& counter : counters)
+        objects.push_back(ponder::UserObject::makeRef(counter));
+    const ponder::Args args(1);
+    std::vector<ponder::Value> results(objects.size());
+
+    BENCHMARK("runtime::call per object")
+    {
+        for (size_t i = 0; i < objects.size(); ++i)
+            results[i] = ponder::runtime::call(add, objects[i], 1);
+        return results.back();
+    };
+
+    BENCHMARK("ObjectCaller::call per object")
+    {
+        ponder::runtime::ObjectCaller caller(add);
+        for (size_t i = 0; i < objects.size(); ++i)
+            results[i] = caller.call(objects[i], args);
+        return results.back();
+    };
+
+    BENCHMARK("runtime::callBatch")
+    {
+        ponder::runtime::callBatch(add, objects.data(), objects.size(), args, results.data());
+        return results.back();
+    };
+}
+
+TEST_CASE("Asynchronous call overhead", PERF_TAG)
+{
+    const ponder::Function& add = ponder::classByType<Counter>().function("add");
+    Counter counter;
+    const ponder::UserObject object(&counter);
+    ponder::parallel::ThreadPool pool(1);
+    int i = 0;
+
+    BENCHMARK("runtime::call")
+    {
+        return ponder::runtime::call(add, object, ++i);
+    };
+
+    BENCHMARK("runtime::callAsync and wait")
+    {
+        return ponder::runtime::callAsync(pool, add, object, ++i).get();
+    };
+}
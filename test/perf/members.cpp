@@ -0,0 +1,111 @@
+/****************************************************************************
+**
+** This file is part of the Ponder library, formerly CAMP.
+**
+** The MIT License (MIT)
+**
+** Copyright (C) 2015-2020 Nick Trout.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a copy
+** of this software and associated documentation files (the "Software"), to deal
+** in the Software without restriction, including without limitation the rights
+** to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+** copies of the Software, and to permit persons to whom the Software is
+** furnished to do so, subject to the following conditions:
+** 
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+** 
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+** OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+** THE SOFTWARE.
+**
+****************************************************************************/
+
+// Benchmarks for looking up class members by name, hashed name and handle.
+
+#include <ponder/classbuilder.hpp>
+#include "perf.hpp"
+
+namespace MembersPerf
+{
+    template <bool Frozen>
+    struct Members
+    {
+        int alpha, bravo, charlie, delta, echo, foxtrot, golf, hotel, india, juliet, kilo, lima;
+    };
+
+    template <bool Frozen>
+    void declare()
+    {
+        auto builder = ponder::Class::declare<Members<Frozen>>();
+        builder
+            .property("alpha", &Members<Frozen>::alpha)
+            .property("bravo", &Members<Frozen>::bravo)
+            .property("charlie", &Members<Frozen>::charlie)
+            .property("delta", &Members<Frozen>::delta)
+            .property("echo", &Members<Frozen>::echo)
+            .property("foxtrot", &Members<Frozen>::foxtrot)
+            .property("golf", &Members<Frozen>::golf)
+            .property("hotel", &Members<Frozen>::hotel)
+            .property("india", &Members<Frozen>::india)
+            .property("juliet", &Members<Frozen>::juliet)
+            .property("kilo", &Members<Frozen>::kilo)
+            .property("lima", &Members<Frozen>::lima);
+        if (Frozen)
+            builder.freeze();
+    }
+}
+
+PONDER_AUTO_TYPE(MembersPerf::Members<false>, &MembersPerf::declare<false>)
+PONDER_AUTO_TYPE(MembersPerf::Members<true>, &MembersPerf::declare<true>)
+
+using namespace MembersPerf;
+using namespace ponder::literals;
+
+TEST_CASE("Class members are found by name, hash and handle")
+{
+    const ponder::Class& dynamic = ponder::classByType<Members<false>>();
+    const ponder::Class& frozen = ponder::classByType<Members<true>>();
+    REQUIRE(dynamic.isFrozen() == false);
+    REQUIRE(frozen.isFrozen() == true);
+
+    for (const ponder::Class* cls : {&dynamic, &frozen})
+    {
+        const ponder::Property& prop = cls->property("kilo");
+        REQUIRE(&cls->property("kilo"_pid) == &prop);
+        REQUIRE(&cls->property(cls->propertyHandle("kilo")) == &prop);
+        REQUIRE(cls->hasProperty("zulu"_pid) == false);
+    }
+}
+
+TEST_CASE("Class member lookup cost", PERF_TAG)
+{
+    const ponder::Class& dynamic = ponder::classByType<Members<false>>();
+    const ponder::Class& frozen = ponder::classByType<Members<true>>();
+    const ponder::PropertyHandle handle = frozen.propertyHandle("kilo");
+
+    BENCHMARK("property(name)")
+    {
+        return &dynamic.property("kilo");
+    };
+
+    BENCHMARK("property(name), frozen")
+    {
+        return &frozen.property("kilo");
+    };
+
+    BENCHMARK("property(hashed name), frozen")
+    {
+        return &frozen.property("kilo"_pid);
+    };
+
+    BENCHMARK("property(handle)")
+    {
+        return &frozen.property(handle);
+    };
+}
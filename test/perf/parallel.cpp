@@ -0,0 +1,84 @@
+/****************************************************************************
+**
+** This file is part of the Ponder library, formerly CAMP.
+**
+** The MIT License (MIT)
+**
+** Copyright (C) 2015-2020 Nick Trout.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a copy
+** of this software and associated documentation files (the "Software"), to deal
+** in the Software without restriction, including without limitation the rights
+** to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+** copies of the Software, and to permit persons to whom the Software is
+** furnished to do so, subject to the following conditions:
+** 
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+** 
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+** OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+** THE SOFTWARE.
+**
+****************************************************************************/
+
+
+// Benchmarks for running reflected calls in parallel.
+
+#include <ponder/classbuilder.hpp>
+#include <ponder/uses/parallel.hpp>
+#include "perf.hpp"
+#include <vector>
+
+namespace ParallelPerf
+{
+    struct Body
+    {
+        float position = 0, velocity = 1;
+
+        void update(float dt) {position += velocity * dt;}
+    };
+
+    void declare()
+    {
+        ponder::Class::declare<Body>()
+            .function("update", &Body::update);
+    }
+}
+
+PONDER_AUTO_TYPE(ParallelPerf::Body, &ParallelPerf::declare)
+
+using namespace ParallelPerf;
+
+TEST_CASE("Parallel update cost", PERF_TAG)
+{
+    const ponder::Function& update = ponder::classByType<Body>().function("update");
+    std::vector<Body> bodies(100000);
+    std::vector<ponder::UserObject> objects;
+    for (Body& body : bodies)
+        objects.push_back(ponder::UserObject::makeRef(body));
+    const ponder::Args args(0.1f);
+    ponder::parallel::ThreadPool pool(std::thread::hardware_concurrency());
+
+    BENCHMARK("runtime::callBatch")
+    {
+        ponder::runtime::callBatch(update, objects.data(), objects.size(), args);
+        return bodies.back().position;
+    };
+
+    BENCHMARK("parallel::forEach, default pool")
+    {
+        ponder::parallel::forEach(objects.data(), objects.size(), update, args);
+        return bodies.back().position;
+    };
+
+    BENCHMARK("parallel::forEach, one worker per hardware thread")
+    {
+        ponder::parallel::forEach(pool, objects.data(), objects.size(), update, args);
+        return bodies.back().position;
+    };
+}
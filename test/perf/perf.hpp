@@ -0,0 +1,70 @@
+/****************************************************************************
+**
+** This file is part of the Ponder library, formerly CAMP.
+**
+** The MIT License (MIT)
+**
+** Copyright (C) 2015-2020 Nick Trout.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a copy
+** of this software and associated documentation files (the "Software"), to deal
+** in the Software without restriction, including without limitation the rights
+** to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+** copies of the Software, and to permit persons to whom the Software is
+** furnished to do so, subject to the following conditions:
+** 
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+** 
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+** OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+** THE SOFTWARE.
+**
+****************************************************************************/
+
+#pragma once
+
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include "../catch.hpp"
+
+#include <ponder/pondertype.hpp>
+#include <ponder/detail/util.hpp>
+
+// Benchmarks are tagged with this so that they are hidden from normal test runs.
+#define PERF_TAG "[!benchmark]"
+
+namespace perf {
+
+// Generate distinct C++ types so that we can register large numbers of metaclasses.
+template <int N>
+struct Synthetic
+{
+    int a = N, b = 0;
+    int get() const { return a; }
+};
+
+// Call F::template apply<I>() for each I in [0, N).
+template <typename F, size_t... Is>
+inline void forEachIndex(PONDER__SEQNS::index_sequence<Is...>)
+{
+    int dummy[] = {0, (F::template apply<Is>(), 0)...};
+    (void)dummy;
+}
+
+} // namespace perf
+
+// Register all of the Synthetic<N> types.
+namespace ponder {
+namespace detail {
+template <int N>
+struct StaticTypeDecl<perf::Synthetic<N>>
+{
+    static TypeId id(bool = true) {return calcTypeId<perf::Synthetic<N>>();}
+    static const char* name(bool = true) {return "perf::Synthetic";}
+    static constexpr bool defined = true, copyable = true;
+};
+}}
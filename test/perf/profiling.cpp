@@ -0,0 +1,98 @@
+/****************************************************************************
+**
+** This file is part of the Ponder library, formerly CAMP.
+**
+** The MIT License (MIT)
+**
+** Copyright (C) 2015-2020 Nick Trout.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a copy
+** of this software and associated documentation files (the "Software"), to deal
+** in the Software without restriction, including without limitation the rights
+** to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+** copies of the Software, and to permit persons to whom the Software is
+** furnished to do so, subject to the following conditions:
+** 
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+** 
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+** OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+** THE SOFTWARE.
+**
+****************************************************************************/
+
+
+// Benchmarks for the profiling of reflected calls. These are built as perftest_profiling, with
+// PONDER_PROFILING, compare with the unprofiled calls of function.cpp in perftest.
+
+#include <ponder/classbuilder.hpp>
+#include <ponder/uses/runtime.hpp>
+#include "perf.hpp"
+
+namespace ProfilingPerf
+{
+    struct Counter
+    {
+        int count = 0;
+
+        int add(int n) {return count += n;}
+    };
+
+    void declare()
+    {
+        ponder::Class::declare<Counter>()
+            .function("add", &Counter::add);
+    }
+}
+
+PONDER_AUTO_TYPE(ProfilingPerf::Counter, &ProfilingPerf::declare)
+
+using namespace ProfilingPerf;
+
+TEST_CASE("Profiled calls are counted")
+{
+    const ponder::Function& add = ponder::classByType<Counter>().function("add");
+    Counter counter;
+    const std::uint64_t before = add.stats().calls;
+
+    ponder::runtime::call(add, &counter, 2);
+
+    REQUIRE(add.stats().calls == before + 1);
+}
+
+TEST_CASE("Profiling overhead", PERF_TAG)
+{
+    const ponder::Function& add = ponder::classByType<Counter>().function("add");
+    Counter counter;
+    const ponder::UserObject object(&counter);
+    ponder::runtime::ObjectCaller caller(add);
+    ponder::profiling::detail::CallProfile profile;
+    int i = 0;
+
+    BENCHMARK("runtime call, profiled")
+    {
+        return caller.call(object, ++i);
+    };
+
+    BENCHMARK("record a call")
+    {
+        profile.record(++i, false);
+        return i;
+    };
+
+    BENCHMARK("time and record a call")
+    {
+        ponder::profiling::detail::CallTimer timer(&profile);
+        return ++i;
+    };
+
+    BENCHMARK("Function::stats()")
+    {
+        return add.stats().calls;
+    };
+}
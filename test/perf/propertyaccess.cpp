@@ -0,0 +1,157 @@
+/****************************************************************************
+**
+** This file is part of the Ponder library, formerly CAMP.
+**
+** The MIT License (MIT)
+**
+** Copyright (C) 2015-2020 Nick Trout.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a copy
+** of this software and associated documentation files (the "Software"), to deal
+** in the Software without restriction, including without limitation the rights
+** to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+** copies of the Software, and to permit persons to whom the Software is
+** furnished to do so, subject to the following conditions:
+** 
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+** 
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+** OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+** THE SOFTWARE.
+**
+****************************************************************************/
+
+// Benchmarks for reading and writing properties through Value and by type.
+
+#include <ponder/classbuilder.hpp>
+#include "perf.hpp"
+
+namespace PropertyAccessPerf
+{
+    struct Point
+    {
+        int x = 0;
+        std::string name;
+
+        int getX() const {return x;}
+        void setX(int v) {x = v;}
+    };
+
+    void declare()
+    {
+        ponder::Class::declare<Point>()
+            .property("x", &Point::x)
+            .property("getX", &Point::getX, &Point::setX)
+            .property("name", &Point::name)
+            .property<&Point::x>("staticX")
+            .property<&Point::getX, &Point::setX>("staticGetX");
+    }
+}
+
+PONDER_AUTO_TYPE(PropertyAccessPerf::Point, &PropertyAccessPerf::declare)
+
+using namespace PropertyAccessPerf;
+
+TEST_CASE("Properties read the same through Value and by type")
+{
+    Point point;
+    point.x = 5;
+    point.name = "five";
+    const ponder::UserObject object(&point);
+    const ponder::Class& metaclass = ponder::classByType<Point>();
+
+    REQUIRE(metaclass.property("x").getAs<int>(object) == metaclass.property("x").get(object).to<int>());
+    REQUIRE(metaclass.property("getX").typed<int>().get(object) == 5);
+    REQUIRE(metaclass.property("name").getAs<std::string>(object) == "five");
+    REQUIRE(metaclass.property("staticX").getAs<int>(object) == 5);
+    REQUIRE(metaclass.property("staticGetX").get(object).to<int>() == 5);
+}
+
+TEST_CASE("Property access cost", PERF_TAG)
+{
+    Point point;
+    point.name = "a name long enough to be allocated";
+    const ponder::UserObject object(&point);
+    const ponder::Class& metaclass = ponder::classByType<Point>();
+    const ponder::Property& x = metaclass.property("x");
+    const ponder::Property& getX = metaclass.property("getX");
+    const ponder::Property& name = metaclass.property("name");
+    const ponder::TypedPropertyRef<int> xRef = x.typed<int>();
+    const ponder::TypedPropertyRef<int> getXRef = getX.typed<int>();
+    const ponder::TypedPropertyRef<std::string> nameRef = name.typed<std::string>();
+    const ponder::Property& staticX = metaclass.property("staticX");
+    const ponder::Property& staticGetX = metaclass.property("staticGetX");
+    const ponder::TypedPropertyRef<int> staticXRef = staticX.typed<int>();
+    const ponder::TypedPropertyRef<int> staticGetXRef = staticGetX.typed<int>();
+    int i = 0;
+
+    BENCHMARK("get member, Value")
+    {
+        return x.get(object).to<int>();
+    };
+
+    BENCHMARK("get member, getAs")
+    {
+        return x.getAs<int>(object);
+    };
+
+    BENCHMARK("get member, TypedPropertyRef")
+    {
+        return xRef.get(object);
+    };
+
+    BENCHMARK("set member, Value")
+    {
+        x.set(object, ++i);
+    };
+
+    BENCHMARK("set member, TypedPropertyRef")
+    {
+        xRef.set(object, ++i);
+    };
+
+    BENCHMARK("set getter/setter, Value")
+    {
+        getX.set(object, ++i);
+    };
+
+    BENCHMARK("set getter/setter, TypedPropertyRef")
+    {
+        getXRef.set(object, ++i);
+    };
+
+    BENCHMARK("get member, static accessor, Value")
+    {
+        return staticX.get(object).to<int>();
+    };
+
+    BENCHMARK("get member, static accessor, TypedPropertyRef")
+    {
+        return staticXRef.get(object);
+    };
+
+    BENCHMARK("set getter/setter, static accessors, Value")
+    {
+        staticGetX.set(object, ++i);
+    };
+
+    BENCHMARK("set getter/setter, static accessors, TypedPropertyRef")
+    {
+        staticGetXRef.set(object, ++i);
+    };
+
+    BENCHMARK("get string, Value")
+    {
+        return name.get(object).to<std::string>();
+    };
+
+    BENCHMARK("get string, TypedPropertyRef")
+    {
+        return nameRef.get(object);
+    };
+}
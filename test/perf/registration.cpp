@@ -0,0 +1,159 @@
+/****************************************************************************
+**
+** This file is part of the Ponder library, formerly CAMP.
+**
+** The MIT License (MIT)
+**
+** Copyright (C) 2015-2020 Nick Trout.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a copy
+** of this software and associated documentation files (the "Software"), to deal
+** in the Software without restriction, including without limitation the rights
+** to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+** copies of the Software, and to permit persons to whom the Software is
+** furnished to do so, subject to the following conditions:
+** 
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+** 
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+** OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+** THE SOFTWARE.
+**
+****************************************************************************/
+
+// Benchmarks for declaring large numbers of metaclasses with many members.
+
+#include <ponder/classbuilder.hpp>
+#include "perf.hpp"
+#include <string>
+#include <vector>
+
+namespace RegistrationPerf
+{
+    constexpr size_t c_types = 8;           // Distinct derived types, declared in turn
+    constexpr size_t c_rounds = 128;        // Declarations of each type per benchmark run
+    constexpr size_t c_baseMembers = 128;   // Properties and functions of the base
+    constexpr size_t c_members = 32;        // Properties and functions of each derived class
+
+    struct Root
+    {
+        int a = 0;
+        int get() const { return a; }
+    };
+
+    template <size_t N>
+    struct Leaf : Root
+    {
+    };
+
+    // Member names, generated in a scrambled order so they are not declared pre-sorted.
+    const std::vector<std::string>& names(const char* prefix, size_t count)
+    {
+        static std::vector<std::string> base, leaf;
+        std::vector<std::string>& v = prefix[0] == 'b' ? base : leaf;
+        if (v.empty())
+        {
+            for (size_t i = 0; i < count; ++i)
+                v.push_back(prefix + std::to_string((i * 7919) % count));
+        }
+        return v;
+    }
+
+    template <typename T>
+    void addMembers(ponder::ClassBuilder<T>& builder, const std::vector<std::string>& n)
+    {
+        for (auto const& name : n)
+        {
+            builder.property(name, &Root::a);
+            builder.function(name + "_f", &Root::get);
+        }
+    }
+
+    struct Declare
+    {
+        template <size_t I>
+        static void apply()
+        {
+            auto builder = ponder::Class::declare<Leaf<I>>("RegistrationPerf::Leaf" + std::to_string(I));
+            builder.template base<Root>();
+            addMembers(builder, names("l", c_members));
+        }
+    };
+
+    struct Undeclare
+    {
+        template <size_t I>
+        static void apply()
+        {
+            ponder::Class::undeclare<Leaf<I>>();
+        }
+    };
+
+    void declareRoot()
+    {
+        auto builder = ponder::Class::declare<Root>("RegistrationPerf::Root");
+        addMembers(builder, names("b", c_baseMembers));
+    }
+
+    void declareLeaves()
+    {
+        perf::forEachIndex<Declare>(PONDER__SEQNS::make_index_sequence<c_types>());
+    }
+
+    void undeclareLeaves()
+    {
+        perf::forEachIndex<Undeclare>(PONDER__SEQNS::make_index_sequence<c_types>());
+    }
+}
+
+PONDER_TYPE(RegistrationPerf::Root)
+
+namespace ponder {
+namespace detail {
+template <size_t N>
+struct StaticTypeDecl<RegistrationPerf::Leaf<N>>
+{
+    static TypeId id(bool = true) {return calcTypeId<RegistrationPerf::Leaf<N>>();}
+    static const char* name(bool = true) {return "RegistrationPerf::Leaf";}
+    static constexpr bool defined = true, copyable = true;
+};
+}}
+
+using namespace RegistrationPerf;
+
+TEST_CASE("Many classes with many members can be declared")
+{
+    declareRoot();
+    declareLeaves();
+
+    const ponder::Class& leaf = ponder::classByType<Leaf<c_types - 1>>();
+    REQUIRE(leaf.propertyCount() == c_baseMembers + c_members);
+    REQUIRE(leaf.functionCount() == c_baseMembers + c_members);
+    REQUIRE(leaf.hasProperty("b0"));
+    REQUIRE(leaf.hasFunction("l31_f"));
+
+    undeclareLeaves();
+    ponder::Class::undeclare<Root>();
+    REQUIRE(ponder::classByTypeSafe<Leaf<0>>() == nullptr);
+}
+
+TEST_CASE("Class registration cost", PERF_TAG)
+{
+    // A few types declared many times, so the benchmark doesn't instantiate a ClassBuilder
+    // for each class declared.
+    declareRoot();
+    BENCHMARK("declare and undeclare 1024 classes")
+    {
+        for (size_t i = 0; i < c_rounds; ++i)
+        {
+            declareLeaves();
+            undeclareLeaves();
+        }
+    };
+    ponder::Class::undeclare<Root>();
+}
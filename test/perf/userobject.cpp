@@ -0,0 +1,128 @@
+/****************************************************************************
+**
+** This file is part of the Ponder library, formerly CAMP.
+**
+** The MIT License (MIT)
+**
+** Copyright (C) 2015-2020 Nick Trout.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a copy
+** of this software and associated documentation files (the "Software"), to deal
+** in the Software without restriction, including without limitation the rights
+** to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+** copies of the Software, and to permit persons to whom the Software is
+** furnished to do so, subject to the following conditions:
+** 
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+** 
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+** OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+** THE SOFTWARE.
+**
+****************************************************************************/
+
+
+// Benchmarks for creating user objects and accessing nested user properties.
+
+#include <ponder/classbuilder.hpp>
+#include "perf.hpp"
+
+namespace UserObjectPerf
+{
+    struct Inner
+    {
+        int x = 3;
+    };
+
+    struct Outer
+    {
+        Inner inner;
+    };
+
+    // Large value object, passed by value.
+    struct Large
+    {
+        int data[1024] = {};
+    };
+
+    void declare()
+    {
+        ponder::Class::declare<Inner>()
+            .property("x", &Inner::x);
+
+        ponder::Class::declare<Outer>()
+            .property("inner", &Outer::inner);
+
+        ponder::Class::declare<Large>();
+    }
+}
+
+PONDER_AUTO_TYPE(UserObjectPerf::Inner, &UserObjectPerf::declare)
+PONDER_AUTO_TYPE(UserObjectPerf::Outer, &UserObjectPerf::declare)
+PONDER_AUTO_TYPE(UserObjectPerf::Large, &UserObjectPerf::declare)
+
+using namespace UserObjectPerf;
+
+TEST_CASE("Nested user properties can be read")
+{
+    Outer outer;
+    outer.inner.x = 7;
+    const ponder::UserObject object = ponder::UserObject::makeRef(outer);
+    REQUIRE(object.get("inner").to<ponder::UserObject>().get("x") == ponder::Value(7));
+}
+
+TEST_CASE("User object creation and nested property cost", PERF_TAG)
+{
+    Outer outer;
+    const ponder::UserObject object = ponder::UserObject::makeRef(outer);
+    const ponder::PropertyHandle inner = ponder::classByType<Outer>().propertyHandle("inner");
+    const ponder::PropertyHandle x = ponder::classByType<Inner>().propertyHandle("x");
+
+    BENCHMARK("auto type id")
+    {
+        return ponder::detail::getTypeId<Outer>();
+    };
+
+    BENCHMARK("classByType")
+    {
+        return &ponder::classByType<Outer>();
+    };
+
+    BENCHMARK("UserObject::makeRef")
+    {
+        return ponder::UserObject::makeRef(outer);
+    };
+
+    BENCHMARK("UserObject::makeCopy")
+    {
+        return ponder::UserObject::makeCopy(outer);
+    };
+
+    BENCHMARK("nested property get")
+    {
+        return object.get(inner).to<ponder::UserObject>().get(x);
+    };
+}
+
+TEST_CASE("Large value object copy cost", PERF_TAG)
+{
+    Large large;
+    const ponder::UserObject copied = ponder::UserObject::makeCopy(large);
+    const ponder::UserObject cow = ponder::UserObject::makeCopyOnWrite(large);
+
+    // A value copy of the object, as made when passing it on by value.
+    BENCHMARK("pass by value, makeCopy")
+    {
+        return ponder::Value(ponder::UserObject::makeCopy(copied.cref<Large>()));
+    };
+
+    BENCHMARK("pass by value, copy on write")
+    {
+        return ponder::Value(cow);
+    };
+}
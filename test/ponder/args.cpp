@@ -0,0 +1,183 @@
+/****************************************************************************
+ **
+ ** This file is part of the Ponder library, formerly CAMP.
+ **
+ ** The MIT License (MIT)
+ **
+ ** Copyright (C) 2009-2010 TECHNOGERMA Systems France and/or its subsidiary(-ies).
+ ** Copyright (C) 2015-2020 Nick Trout.
+ **
+ ** Permission is hereby granted, free of charge, to any person obtaining a copy
+ ** of this software and associated documentation files (the "Software"), to deal
+ ** in the Software without restriction, including without limitation the rights
+ ** to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ ** copies of the Software, and to permit persons to whom the Software is
+ ** furnished to do so, subject to the following conditions:
+ **
+ ** The above copyright notice and this permission notice shall be included in
+ ** all copies or substantial portions of the Software.
+ **
+ ** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ ** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ ** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ ** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ ** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ ** OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ ** THE SOFTWARE.
+ **
+ ****************************************************************************/
+
+// Tests for ponder::Args.
+
+#include <ponder/classbuilder.hpp>
+#include <ponder/uses/runtime.hpp>
+#include "test.hpp"
+#include <atomic>
+
+// Heap allocation count, from userobject.cpp.
+extern std::atomic<size_t> g_allocCount;
+
+namespace ArgsTest
+{
+    struct Adder
+    {
+        int total = 0;
+
+        int add(int a, int b, int c) {return total += a + b + c;}
+    };
+
+    void declare()
+    {
+        ponder::Class::declare<Adder>()
+            .function("add", &Adder::add);
+    }
+}
+
+PONDER_AUTO_TYPE(ArgsTest::Adder, &ArgsTest::declare)
+
+using namespace ArgsTest;
+
+//-----------------------------------------------------------------------------
+//                         Tests for ponder::Args
+//-----------------------------------------------------------------------------
+
+TEST_CASE("Args hold lists of values")
+{
+    SECTION("construction")
+    {
+        REQUIRE(ponder::Args().count() == 0);
+        REQUIRE(ponder::Args::empty.count() == 0);
+
+        const ponder::Args args(1, true, "hello");
+        REQUIRE(args.count() == 3);
+        REQUIRE(args[0] == ponder::Value(1));
+        REQUIRE(args[1] == ponder::Value(true));
+        REQUIRE(args[2] == ponder::Value("hello"));
+        REQUIRE_THROWS_AS(args[3], ponder::OutOfRange);
+
+        const ponder::Args copy(args);
+        REQUIRE(copy.count() == 3);
+        REQUIRE(copy[2] == ponder::Value("hello"));
+    }
+
+    SECTION("append")
+    {
+        ponder::Args args;
+        args += 1;
+        args += ponder::Value(2);
+        const ponder::Args more = args + 3;
+        REQUIRE(args.count() == 2);
+        REQUIRE(more.count() == 3);
+        REQUIRE(more[2] == ponder::Value(3));
+
+        const ponder::Args moved = ponder::Args(1) + 2;
+        REQUIRE(moved.count() == 2);
+        REQUIRE(moved[1] == ponder::Value(2));
+    }
+
+    SECTION("insert")
+    {
+        ponder::Args args(1, 2, 3);
+        args.insert(0, 0);
+        args.insert(2, 10);
+        args.insert(5, 4);
+        args.insert(0, -1);
+        REQUIRE(args.count() == 7);
+        const int expected[] = {-1, 0, 1, 10, 2, 3, 4};
+        for (size_t i = 0; i < args.count(); ++i)
+            REQUIRE(args[i] == ponder::Value(expected[i]));
+
+        REQUIRE_THROWS_AS(args.insert(9, 0), ponder::OutOfRange);
+    }
+
+    SECTION("set")
+    {
+        ponder::Args args(1, 2);
+        args.insert(0, 0);
+        args.set(0, "zero");
+        args.set(2, 20);
+        REQUIRE(args[0] == ponder::Value("zero"));
+        REQUIRE(args[1] == ponder::Value(1));
+        REQUIRE(args[2] == ponder::Value(20));
+
+        REQUIRE_THROWS_AS(args.set(3, 0), ponder::OutOfRange);
+    }
+
+    SECTION("copy and move")
+    {
+        ponder::Args args(1, "two");
+        args.insert(0, 0);
+
+        ponder::Args copy;
+        copy = args;
+        REQUIRE(copy.count() == 3);
+        REQUIRE(copy[1] == ponder::Value(1));
+
+        ponder::Args moved(std::move(copy));
+        REQUIRE(moved.count() == 3);
+        REQUIRE(moved[2] == ponder::Value("two"));
+        REQUIRE(copy.count() == 0);
+
+        ponder::Args large(0, 1, 2, 3, 4, 5, 6, 7);
+        large = std::move(moved);
+        REQUIRE(large.count() == 3);
+        REQUIRE(large[0] == ponder::Value(0));
+
+        moved = ponder::Args(0, 1, 2, 3, 4, 5, 6, 7);
+        REQUIRE(moved.count() == 8);
+        REQUIRE(moved[7] == ponder::Value(7));
+    }
+
+    SECTION("more values than fit inline")
+    {
+        ponder::Args args(0, 1, 2, 3, 4, 5, 6, 7);
+        REQUIRE(args.count() == 8);
+        args += 8;
+        args.insert(0, -1);
+        for (size_t i = 0; i < args.count(); ++i)
+            REQUIRE(args[i] == ponder::Value(int(i) - 1));
+
+        ponder::Args grown;
+        for (int i = 0; i < 10; ++i)
+            grown += i;
+        REQUIRE(grown.count() == 10);
+        REQUIRE(grown[9] == ponder::Value(9));
+    }
+}
+
+TEST_CASE("Reflected calls with few arguments do not allocate")
+{
+    const ponder::Function& add = ponder::classByType<Adder>().function("add");
+    Adder adder;
+    const ponder::UserObject object(&adder);
+
+    ponder::runtime::call(add, object, 1, 2, 3); // warm up
+
+    const size_t before = g_allocCount;
+    const ponder::Value result = ponder::runtime::call(add, object, 1, 2, 3);
+    REQUIRE(g_allocCount == before);
+    REQUIRE(result == ponder::Value(12));
+
+    const ponder::Args args(1, 2, 3, 4, 5, 6);
+    REQUIRE(g_allocCount == before);
+}
@@ -0,0 +1,158 @@
+/****************************************************************************
+ **
+ ** This file is part of the Ponder library, formerly CAMP.
+ **
+ ** The MIT License (MIT)
+ **
+ ** Copyright (C) 2009-2010 TECHNOGERMA Systems France and/or its subsidiary(-ies).
+ ** Copyright (C) 2015-2020 Nick Trout.
+ **
+ ** Permission is hereby granted, free of charge, to any person obtaining a copy
+ ** of this software and associated documentation files (the "Software"), to deal
+ ** in the Software without restriction, including without limitation the rights
+ ** to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ ** copies of the Software, and to permit persons to whom the Software is
+ ** furnished to do so, subject to the following conditions:
+ **
+ ** The above copyright notice and this permission notice shall be included in
+ ** all copies or substantial portions of the Software.
+ **
+ ** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ ** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ ** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ ** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ ** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ ** OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ ** THE SOFTWARE.
+ **
+ ****************************************************************************/
+
+// Tests for asynchronous calls, ponder::runtime::callAsync().
+
+#include <ponder/classbuilder.hpp>
+#include <ponder/uses/async.hpp>
+#include "test.hpp"
+#include <deque>
+#include <stdexcept>
+
+namespace AsyncTest
+{
+    struct Account
+    {
+        int balance = 0;
+
+        int deposit(int amount) {return balance += amount;}
+        void fail() {throw std::runtime_error("fail");}
+        static ponder::String describe(int id, ponder::String name)
+        {
+            return name + " " + std::to_string(id);
+        }
+    };
+
+    void declare()
+    {
+        ponder::Class::declare<Account>()
+            .function("deposit", &Account::deposit)
+            .function("fail", &Account::fail)
+            .function("describe", &Account::describe);
+    }
+
+    // Runs the tasks when asked to, on the calling thread
+    struct ManualExecutor : ponder::parallel::Executor
+    {
+        void submit(Task task) override {tasks.push_back(std::move(task));}
+
+        void runAll()
+        {
+            while (!tasks.empty())
+            {
+                Task task = std::move(tasks.front());
+                tasks.pop_front();
+                task();
+            }
+        }
+
+        std::deque<Task> tasks;
+    };
+}
+
+PONDER_AUTO_TYPE(AsyncTest::Account, &AsyncTest::declare)
+
+using namespace AsyncTest;
+
+//-----------------------------------------------------------------------------
+//                         Tests for ponder::runtime::callAsync
+//-----------------------------------------------------------------------------
+
+TEST_CASE("Functions can be called asynchronously")
+{
+    const ponder::Class& metaclass = ponder::classByType<Account>();
+    Account account;
+    const ponder::UserObject object = ponder::UserObject::makeRef(account);
+
+    SECTION("on the default pool")
+    {
+        std::future<ponder::Value> result =
+            ponder::runtime::callAsync(metaclass.function("deposit"), object, 10);
+        REQUIRE(result.get() == ponder::Value(10));
+        REQUIRE(account.balance == 10);
+
+        result = ponder::runtime::callStaticAsync(metaclass.function("describe"), 7, "account");
+        REQUIRE(result.get() == ponder::Value("account 7"));
+    }
+
+    SECTION("on a thread pool")
+    {
+        ponder::parallel::ThreadPool pool(2);
+        std::vector<std::future<ponder::Value>> results;
+        for (int i = 1; i <= 3; ++i)
+        {
+            results.push_back(ponder::runtime::callStaticAsync(pool, metaclass.function("describe"),
+                                                              i, "account"));
+        }
+        REQUIRE(results[0].get() == ponder::Value("account 1"));
+        REQUIRE(results[2].get() == ponder::Value("account 3"));
+    }
+
+    SECTION("from a task of the same pool")
+    {
+        // With one worker, the call is queued behind the task waiting for it
+        ponder::parallel::ThreadPool pool(1);
+        std::promise<int> done;
+        pool.submit([&]
+        {
+            std::future<ponder::Value> result =
+                ponder::runtime::callAsync(pool, metaclass.function("deposit"), object, 4);
+            done.set_value(pool.wait(result).to<int>());
+        });
+        REQUIRE(done.get_future().get() == 4);
+        REQUIRE(account.balance == 4);
+    }
+
+    SECTION("on a custom executor")
+    {
+        ManualExecutor executor;
+        int amount = 5; // arguments are packed when the call is made
+        std::future<ponder::Value> result =
+            ponder::runtime::callAsync(executor, metaclass.function("deposit"), object, amount);
+        amount = 6;
+
+        REQUIRE(executor.tasks.size() == 1);
+        REQUIRE(account.balance == 0);
+        executor.runAll();
+        REQUIRE(result.get() == ponder::Value(5));
+    }
+
+    SECTION("errors are stored in the future")
+    {
+        ManualExecutor executor;
+        std::future<ponder::Value> failed =
+            ponder::runtime::callAsync(executor, metaclass.function("fail"), object);
+        std::future<ponder::Value> noArgs =
+            ponder::runtime::callAsync(executor, metaclass.function("deposit"), object);
+        executor.runAll();
+
+        REQUIRE_THROWS_AS(failed.get(), std::runtime_error);
+        REQUIRE_THROWS_AS(noArgs.get(), ponder::NotEnoughArguments);
+    }
+}
@@ -33,6 +33,7 @@
 //  - Property accessing.
 //  - Get class by name/type.
 //  - Undeclare types.
+//  - Freezing types.
 
 #include <ponder/classbuilder.hpp>
 #include "test.hpp"
@@ -83,6 +84,12 @@ namespace ClassTest
     {
         int a, b;
     };
+
+    struct FrozenRegistration
+    {
+        int a, b;
+        void func() {}
+    };
     
     struct DifferentName
     {
@@ -194,6 +201,20 @@ namespace ClassTest
     {
         ponder::Class::undeclare<TemporaryRegistration>();
     }
+
+    struct AutoRegistration
+    {
+        int a;
+    };
+
+    int autoRegistrationCount = 0;
+
+    void declare_auto()
+    {
+        ++autoRegistrationCount;
+        ponder::Class::declare<AutoRegistration>()
+            .property("a", &AutoRegistration::a);
+    }
     
 } // namespace ClassTest
 
@@ -221,7 +242,10 @@ PONDER_AUTO_TYPE(ClassTest::VirtualY, &ClassTest::declare)
 PONDER_AUTO_TYPE(ClassTest::VirtualZ, &ClassTest::declare)
 PONDER_AUTO_TYPE(ClassTest::VirtualUser, &ClassTest::declare)
 
+PONDER_AUTO_TYPE(ClassTest::AutoRegistration, &ClassTest::declare_auto)
+
 PONDER_TYPE(ClassTest::TemporaryRegistration);
+PONDER_TYPE(ClassTest::FrozenRegistration);
 
 using namespace ClassTest;
 
@@ -308,6 +332,18 @@ TEST_CASE("Class metadata can be retrieved")
         REQUIRE(count == ponder::classCount());
     }
     
+    SECTION("by index")
+    {
+        const ponder::Class& class1 = ponder::classByType<MyClass>();
+        const ponder::Class& class2 = ponder::classByType<MyClass2>();
+
+        REQUIRE(class1.index() != class2.index());
+        REQUIRE(class1.index() < ponder::classIndexCount());
+        REQUIRE(ponder::classByIndex(class1.index()) == &class1);
+        REQUIRE(ponder::classByIndex(class2.index()) == &class2);
+        REQUIRE(ponder::classByIndex(ponder::classIndexCount()) == nullptr);
+    }
+
     SECTION("metadata can be compared")
     {
         const ponder::Class& class1 = ponder::classByType<MyClass>();
@@ -358,6 +394,40 @@ TEST_CASE("Class members can be inspected")
         REQUIRE(metaclass.tryFunction("func", fp) == true);
         REQUIRE(fp->name() == "func");
     }
+
+    SECTION("can have member handles")
+    {
+        const ponder::PropertyHandle prop = metaclass.propertyHandle("prop");
+        REQUIRE(prop.isValid());
+        REQUIRE(prop.getClass() == &metaclass);
+        REQUIRE(&metaclass.property(prop) == &metaclass.property("prop"));
+        REQUIRE((prop == metaclass.propertyHandle("prop")));
+        REQUIRE_THROWS_AS(metaclass.propertyHandle("xxxx"), ponder::PropertyNotFound);
+
+        const ponder::FunctionHandle func = metaclass.functionHandle("func");
+        REQUIRE(func.isValid());
+        REQUIRE(&metaclass.function(func) == &metaclass.function("func"));
+        REQUIRE_THROWS_AS(metaclass.functionHandle("xxxx"), ponder::FunctionNotFound);
+
+        REQUIRE(ponder::PropertyHandle().isValid() == false);
+    }
+
+    SECTION("can find members by hashed name")
+    {
+        using namespace ponder::literals;
+
+        REQUIRE(metaclass.hasProperty("prop"_pid) == true);
+        REQUIRE(metaclass.hasProperty("xxxx"_pid) == false);
+        REQUIRE(&metaclass.property("prop"_pid) == &metaclass.property("prop"));
+        REQUIRE_THROWS_AS(metaclass.property("xxxx"_pid), ponder::PropertyNotFound);
+
+        REQUIRE(metaclass.hasFunction("func"_pid) == true);
+        REQUIRE(&metaclass.function("func"_pid) == &metaclass.function("func"));
+        const ponder::Function *fp = nullptr;
+        REQUIRE(metaclass.tryFunction("xxxx"_pid, fp) == false);
+        REQUIRE(metaclass.tryFunction("func"_pid, fp) == true);
+        REQUIRE(fp->name() == "func");
+    }
     
     SECTION("can iterate over properties")
     {
@@ -461,6 +531,7 @@ TEST_CASE("Classes can by undeclared")
     
         REQUIRE(tempClass.baseCount() == 1u);
         REQUIRE(tempClass.base(0).name() == "ClassTest::Base");
+        REQUIRE(&ponder::classByName("ClassTest::TemporaryRegistration") == &tempClass);
     }
     
     SECTION("do undeclare")
@@ -468,9 +539,118 @@ TEST_CASE("Classes can by undeclared")
         undeclare_temp();
 
         REQUIRE(ponder::classByTypeSafe<TemporaryRegistration>() == nullptr);
+        REQUIRE_THROWS_AS(ponder::classByName("ClassTest::TemporaryRegistration"),
+                          ponder::ClassNotFound);
+    }
+
+    SECTION("index is released")
+    {
+        declare_temp();
+        const size_t index = ponder::classByType<TemporaryRegistration>().index();
+        undeclare_temp();
+        REQUIRE(ponder::classByIndex(index) == nullptr);
+
+        // the free index is reused
+        declare_temp();
+        REQUIRE(ponder::classByType<TemporaryRegistration>().index() == index);
+        undeclare_temp();
+    }
+
+    SECTION("redeclare")
+    {
+        // Cached type lookups must follow the new metaclass. The cache is filled by the
+        // declaration, lookups only read it.
+        declare_temp();
+        const ponder::Class* cached =
+            ponder::detail::ClassCache<TemporaryRegistration>::slot.load();
+        const ponder::Class& tempClass = ponder::classByType<TemporaryRegistration>();
+        REQUIRE(cached == &tempClass);
+        REQUIRE(ponder::classByTypeSafe<TemporaryRegistration>() == &tempClass);
+        REQUIRE(&ponder::classByName("ClassTest::TemporaryRegistration") == &tempClass);
+
+        undeclare_temp();
+        REQUIRE(ponder::classByTypeSafe<TemporaryRegistration>() == nullptr);
+        REQUIRE_THROWS_AS(ponder::classByType<TemporaryRegistration>(), ponder::ClassNotFound);
+    }
+}
+
+
+TEST_CASE("Classes can be frozen")
+{
+    auto builder = ponder::Class::declare<FrozenRegistration>();
+    builder
+        .property("a", &FrozenRegistration::a)
+        .property("b", &FrozenRegistration::b)
+        .function("func", &FrozenRegistration::func);
+
+    const ponder::Class& metaclass = ponder::classByType<FrozenRegistration>();
+
+    SECTION("individually")
+    {
+        REQUIRE(metaclass.isFrozen() == false);
+        builder.freeze();
+        REQUIRE(metaclass.isFrozen() == true);
     }
+
+    SECTION("all at once")
+    {
+        const ponder::Class& other = ponder::classByType<MyClass>();
+        REQUIRE(metaclass.isFrozen() == false);
+        ponder::freezeClasses();
+        REQUIRE(metaclass.isFrozen() == true);
+        REQUIRE(other.isFrozen() == true);
+    }
+
+    // lookups still work
+    REQUIRE(metaclass.hasProperty("a"));
+    REQUIRE(metaclass.hasProperty("b"));
+    REQUIRE(metaclass.property("b").name() == "b");
+    REQUIRE(metaclass.hasFunction("func"));
+    {
+        using namespace ponder::literals;
+        constexpr ponder::HashedId b = "b"_pid;
+        static_assert(b.hash() == ponder::detail::hashString("b", 1), "Compile time hash");
+        REQUIRE(&metaclass.property(b) == &metaclass.property("b"));
+        REQUIRE(metaclass.hasProperty("c"_pid) == false);
+        REQUIRE(metaclass.hasFunction("func"_pid));
+    }
+    REQUIRE(metaclass.hasProperty("c") == false);
+    REQUIRE(metaclass.hasFunction("") == false);
+    REQUIRE_THROWS_AS(metaclass.property("func"), ponder::PropertyNotFound);
+
+    FrozenRegistration obj;
+    obj.b = 7;
+    REQUIRE(metaclass.property("b").get(ponder::UserObject::makeRef(obj)) == ponder::Value(7));
+
+    // but can't be modified
+    REQUIRE_THROWS_AS(builder.property("c", &FrozenRegistration::a), ponder::ClassFrozen);
+    REQUIRE_THROWS_AS(builder.constructor<>(), ponder::ClassFrozen);
+    REQUIRE(metaclass.propertyCount() == 2u);
+
+    ponder::Class::undeclare<FrozenRegistration>();
 }
 
+TEST_CASE("Automatic class registration happens once")
+{
+    REQUIRE(autoRegistrationCount == 0);
+
+    auto const& metaclass = ponder::classByType<AutoRegistration>();
+    REQUIRE(autoRegistrationCount == 1);
+    REQUIRE(metaclass.hasProperty("a"));
+
+    for (int i = 0; i < 4; ++i)
+    {
+        REQUIRE(ponder::detail::getTypeId<AutoRegistration>()
+                == ponder::detail::calcTypeId<AutoRegistration>());
+        REQUIRE(ponder::classByType<AutoRegistration>().name() == metaclass.name());
+    }
+    REQUIRE(autoRegistrationCount == 1);
+
+    // Undeclaring resets the registration, the class is declared again when next used
+    ponder::Class::undeclare<AutoRegistration>();
+    REQUIRE(ponder::classByType<AutoRegistration>().hasProperty("a"));
+    REQUIRE(autoRegistrationCount == 2);
+}
 
 TEST_CASE("Classes can be templates")
 {
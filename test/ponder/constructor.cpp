@@ -100,6 +100,18 @@ namespace ConstructorTest
         MyEnum e;
         MyType u;
     };
+
+    // Constructors with the same arity, told apart by argument types
+    struct Overloaded
+    {
+        Overloaded(long) : which(1) {}
+        Overloaded(MyEnum) : which(2) {}
+        Overloaded(MyType) : which(3) {}
+        Overloaded(MyBase1) : which(4) {}
+        Overloaded(long, long) : which(5) {}
+
+        int which;
+    };
         
     void declare()
     {
@@ -126,6 +138,13 @@ namespace ConstructorTest
             .constructor<long, double, ponder::String, MyEnum>()        
             // trying types that don't exactly match those declared
             .constructor<unsigned short, float, ponder::String, MyEnum, int>();
+
+        ponder::Class::declare<Overloaded>("ConstructorTest::Overloaded")
+            .constructor<long>()
+            .constructor<MyEnum>()
+            .constructor<MyType>()
+            .constructor<MyBase1>()
+            .constructor<long, long>();
     }
 }
 
@@ -134,6 +153,7 @@ PONDER_AUTO_TYPE(ConstructorTest::MyType, &ConstructorTest::declare)
 PONDER_AUTO_TYPE(ConstructorTest::MyBase1, &ConstructorTest::declare)
 PONDER_AUTO_TYPE(ConstructorTest::MyBase2, &ConstructorTest::declare)
 PONDER_AUTO_TYPE(ConstructorTest::MyClass, &ConstructorTest::declare)
+PONDER_AUTO_TYPE(ConstructorTest::Overloaded, &ConstructorTest::declare)
 
 
 using namespace ConstructorTest;
@@ -377,6 +397,53 @@ TEST_CASE("Classes can have constructors") // and allocate dynamically
     }
 }
 
+TEST_CASE("Constructors are resolved by argument types")
+{
+    const ponder::Class& metaclass = ponder::classByType<Overloaded>();
+    ponder::runtime::ObjectFactory fact(metaclass);
+
+    auto which = [&](const ponder::Args& args)
+    {
+        ponder::UserObject object = fact.construct(args);
+        return object == ponder::UserObject::nothing ? 0 : object.get<Overloaded>().which;
+    };
+
+    SECTION("each signature finds its constructor")
+    {
+        // Twice, so that the second lookups use the resolutions cached by the first
+        for (int i = 0; i < 2; ++i)
+        {
+            REQUIRE(which(ponder::Args(7)) == 1);
+            REQUIRE(which(ponder::Args(two)) == 2);
+            REQUIRE(which(ponder::Args(MyType(1))) == 3);
+            REQUIRE(which(ponder::Args(MyBase1())) == 4);
+            REQUIRE(which(ponder::Args(1, 2)) == 5);
+        }
+    }
+
+    SECTION("found constructors are the declared ones")
+    {
+        REQUIRE(metaclass.constructorCount() == 5);
+        REQUIRE(metaclass.findConstructor(ponder::Args(7)) == metaclass.constructor(0));
+        REQUIRE(metaclass.findConstructor(ponder::Args(MyBase1())) == metaclass.constructor(3));
+        REQUIRE(metaclass.findConstructor(ponder::Args(MyBase1())) == metaclass.constructor(3));
+        REQUIRE(metaclass.findConstructor(ponder::Args(1, 2)) == metaclass.constructor(4));
+    }
+
+    SECTION("signatures without constructor")
+    {
+        for (int i = 0; i < 2; ++i)
+        {
+            REQUIRE(metaclass.findConstructor(ponder::Args()) == nullptr);
+            REQUIRE(metaclass.findConstructor(ponder::Args("hello")) == nullptr);
+            REQUIRE(metaclass.findConstructor(ponder::Args(MyBase2())) == nullptr);
+            REQUIRE(metaclass.findConstructor(ponder::Args(1, 2, 3)) == nullptr);
+            REQUIRE(metaclass.findConstructor(ponder::Args(1, 2, 3, 4, 5, 6, 7)) == nullptr);
+            REQUIRE(which(ponder::Args(1, "hello")) == 0);
+        }
+    }
+}
+
 
 //TEST_CASE("Object factories can be used to create class instances") // and allocate dynamically
 //{
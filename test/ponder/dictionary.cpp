@@ -33,9 +33,12 @@
 #include <ponder/detail/dictionary.hpp>
 #include "test.hpp"
 #include <string.h>
+#include <atomic>
 
 using namespace ponder;
 
+extern std::atomic<size_t> g_allocCount;   // userobject.cpp
+
 //-----------------------------------------------------------------------------
 //                         Tests for Ponder detail::dictionary
 //-----------------------------------------------------------------------------
@@ -201,3 +204,132 @@ TEST_CASE("Dictionary can have customised sorter")
     }
 }
 
+TEST_CASE("Dictionary can be indexed")
+{
+    typedef ponder::detail::Dictionary<Id, IdRef, int> Dict;
+    Dict dict;
+
+    REQUIRE(dict.buildIndex() == false); // nothing to index
+    REQUIRE(dict.findKey("alpha") == dict.end());
+
+    const int count = 300;
+    for (int i = 0; i < count; ++i)
+        dict.insert("key" + std::to_string(i), i);
+
+    REQUIRE(dict.isIndexed() == false);
+    REQUIRE(dict.buildIndex() == true);
+    REQUIRE(dict.isIndexed() == true);
+
+    SECTION("finds all keys")
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            const Id key("key" + std::to_string(i));
+            auto it = dict.findKey(key);
+            REQUIRE(it != dict.end());
+            REQUIRE(it->second == i);
+            REQUIRE(dict.findKey(key, ponder::detail::hashString(key)) == it);
+        }
+    }
+
+    SECTION("misses keys")
+    {
+        REQUIRE(dict.containsKey("") == false);
+        REQUIRE(dict.containsKey("key") == false);
+        REQUIRE(dict.containsKey("key300") == false);
+        REQUIRE(dict.containsKey("monkey") == false);
+    }
+
+    SECTION("keeps order")
+    {
+        REQUIRE(dict.at(0)->first == Id("key0"));
+        REQUIRE(dict.at(1)->first == Id("key1"));
+        REQUIRE(dict.at(2)->first == Id("key10"));
+    }
+
+    SECTION("modification drops index")
+    {
+        dict.insert("alpha", -1);
+        REQUIRE(dict.isIndexed() == false);
+        REQUIRE(dict.containsKey("alpha"));
+        REQUIRE(dict.containsKey("key42"));
+
+        REQUIRE(dict.buildIndex() == true);
+        dict.erase("key42");
+        REQUIRE(dict.isIndexed() == false);
+        REQUIRE(dict.containsKey("key42") == false);
+        REQUIRE(dict.containsKey("key43"));
+    }
+}
+
+TEST_CASE("Dictionary can find hashed keys without allocating")
+{
+    typedef ponder::detail::Dictionary<Id, IdRef, int> Dict;
+    Dict dict;
+    for (int i = 0; i < 300; ++i)
+        dict.insert("key" + std::to_string(i), i);
+
+    const std::string name("key123"), missing("key-missing-from-the-dictionary");
+    const std::uint64_t hash = ponder::detail::hashString(name);
+    const std::uint64_t missingHash = ponder::detail::hashString(missing);
+
+    size_t before = g_allocCount;
+    auto found = dict.findHashed(name, hash);
+    auto notFound = dict.findHashed(missing, missingHash);
+    REQUIRE(g_allocCount == before);
+    REQUIRE(found->second == 123);
+    REQUIRE(notFound == dict.end());
+
+    REQUIRE(dict.buildIndex() == true);
+    before = g_allocCount;
+    found = dict.findHashed(name, hash);
+    notFound = dict.findHashed(missing, missingHash);
+    REQUIRE(g_allocCount == before);
+    REQUIRE(found->second == 123);
+    REQUIRE(notFound == dict.end());
+}
+
+TEST_CASE("Dictionary can defer inserts")
+{
+    typedef ponder::detail::Dictionary<Id, IdRef, int> Dict;
+    Dict dict;
+    dict.insert("bravo", 1);
+    dict.insert("echo", 2);
+
+    dict.insertDeferred("zebra", 3);
+    dict.insertDeferred("alpha", 4);
+    dict.insertDeferred("echo", 5);     // replaces existing
+    dict.insertDeferred("alpha", 6);    // replaces deferred
+
+    SECTION("merged on flush")
+    {
+        REQUIRE(dict.size() == 2);
+        REQUIRE(dict.findKey("echo")->second == 2);
+        REQUIRE(dict.containsKey("alpha") == false);
+
+        dict.flush();
+        REQUIRE(dict.size() == 4);
+        REQUIRE(dict.findKey("alpha")->second == 6);
+        REQUIRE(dict.findKey("echo")->second == 5);
+    }
+
+    SECTION("merged in order")
+    {
+        dict.flush();
+        REQUIRE(dict.at(0)->first == Id("alpha"));
+        REQUIRE(dict.at(1)->first == Id("bravo"));
+        REQUIRE(dict.at(2)->first == Id("echo"));
+        REQUIRE(dict.at(3)->first == Id("zebra"));
+        REQUIRE(dict.at(3)->second == 3);
+    }
+
+    SECTION("drops the index")
+    {
+        dict.flush();
+        REQUIRE(dict.buildIndex());
+        dict.insertDeferred("foxtrot", 7);
+        REQUIRE(dict.isIndexed() == false);
+        dict.flush();
+        REQUIRE(dict.containsKey("foxtrot"));
+    }
+}
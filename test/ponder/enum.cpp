@@ -31,6 +31,7 @@
 //  - Can we declare, undeclare, and access enums.
 
 #include <ponder/enum.hpp>
+#include <ponder/value.hpp>
 #include "test.hpp"
 
 namespace EnumTest
@@ -53,6 +54,13 @@ namespace EnumTest
     enum MyEnum2
     {
     };
+
+    enum MySparseEnum
+    {
+        Low  = -1000000,
+        Mid  = 7,
+        High = 1 << 30
+    };
     
     enum TempEnum
     {
@@ -67,6 +75,11 @@ namespace EnumTest
             .value("Two", Two);
         
         ponder::Enum::declare<MyEnum2>("EnumTest::MyEnum2");
+
+        ponder::Enum::declare<MySparseEnum>("EnumTest::MySparseEnum")
+            .value("Low", Low)
+            .value("Mid", Mid)
+            .value("High", High);
     }
     
     static void declare_temp()
@@ -88,6 +101,7 @@ PONDER_TYPE(EnumTest::MyUndeclaredEnum /* never declared */)
 PONDER_TYPE(EnumTest::MyExplicitylyDeclaredEnum /* declared during tests */)
 PONDER_AUTO_TYPE(EnumTest::MyEnum, &EnumTest::declare)
 PONDER_AUTO_TYPE(EnumTest::MyEnum2, &EnumTest::declare)
+PONDER_AUTO_TYPE(EnumTest::MySparseEnum, &EnumTest::declare)
 PONDER_TYPE(EnumTest::TempEnum)
 
 using namespace EnumTest;
@@ -147,6 +161,15 @@ TEST_CASE("Enum metadata can be retrieved")
         
         REQUIRE_THROWS_AS(ponder::enumByType<MyUndeclaredEnum>(), ponder::EnumNotFound);        
     }
+
+    SECTION("by index")
+    {
+        const ponder::Enum& metaenum = ponder::enumByType<MyEnum>();
+
+        REQUIRE(metaenum.index() < ponder::enumIndexCount());
+        REQUIRE(ponder::enumByIndex(metaenum.index()) == &metaenum);
+        REQUIRE(ponder::enumByIndex(ponder::enumIndexCount()) == nullptr);
+    }
     
     SECTION("by instance")
     {
@@ -207,6 +230,23 @@ TEST_CASE("Enum values can be read")
 }
 
 
+TEST_CASE("Sparse enum values can be read")
+{
+    const ponder::Enum& metaenum = ponder::enumByType<MySparseEnum>();
+
+    REQUIRE(metaenum.name(Low) == "Low");
+    REQUIRE(metaenum.name(Mid) == "Mid");
+    REQUIRE(metaenum.name(High) == "High");
+    REQUIRE(metaenum.hasValue(0) == false);
+    REQUIRE(metaenum.hasValue(-1000001) == false);
+    REQUIRE_THROWS_AS(metaenum.name(8), ponder::EnumValueNotFound);
+
+    REQUIRE(metaenum.value("High") == High);
+    REQUIRE(ponder::Value("Mid").to<MySparseEnum>() == Mid);
+    REQUIRE(ponder::Value(Low).to<ponder::String>() == "Low");
+}
+
+
 TEST_CASE("Enum can be undeclared")
 {
     SECTION("before declaration")
@@ -219,6 +259,7 @@ TEST_CASE("Enum can be undeclared")
         declare_temp();
         
         REQUIRE(ponder::enumByType<TempEnum>().hasName("Durian") == true);
+        REQUIRE(&ponder::enumByName("EnumTest::TempEnum") == &ponder::enumByType<TempEnum>());
     }
 
     SECTION("after declaration")
@@ -226,6 +267,7 @@ TEST_CASE("Enum can be undeclared")
         undeclare_temp();
         
         REQUIRE_THROWS_AS(ponder::enumByType<TempEnum>(), ponder::EnumNotFound);
+        REQUIRE_THROWS_AS(ponder::enumByName("EnumTest::TempEnum"), ponder::EnumNotFound);
     }
 }
 
@@ -0,0 +1,297 @@
+/****************************************************************************
+ **
+ ** This file is part of the Ponder library, formerly CAMP.
+ **
+ ** The MIT License (MIT)
+ **
+ ** Copyright (C) 2009-2010 TECHNOGERMA Systems France and/or its subsidiary(-ies).
+ ** Copyright (C) 2015-2020 Nick Trout.
+ **
+ ** Permission is hereby granted, free of charge, to any person obtaining a copy
+ ** of this software and associated documentation files (the "Software"), to deal
+ ** in the Software without restriction, including without limitation the rights
+ ** to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ ** copies of the Software, and to permit persons to whom the Software is
+ ** furnished to do so, subject to the following conditions:
+ **
+ ** The above copyright notice and this permission notice shall be included in
+ ** all copies or substantial portions of the Software.
+ **
+ ** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ ** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ ** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ ** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ ** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ ** OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ ** THE SOFTWARE.
+ **
+ ****************************************************************************/
+
+
+// Tests for the non-throwing API: ponder::Expected and the try* functions.
+
+#include <ponder/classbuilder.hpp>
+#include <ponder/uses/runtime.hpp>
+#include "test.hpp"
+#include <string>
+#include <vector>
+
+namespace ExpectedTest
+{
+    enum class Color
+    {
+        Red,
+        Green
+    };
+
+    struct Point
+    {
+        Point() {}
+        Point(int x_, int y_) : x(x_), y(y_) {}
+
+        int x = 0;
+        int y = 0;
+        Color color = Color::Red;
+        std::vector<int> values;
+
+        int id() const {return 7;}
+        int scale(int factor) {return x *= factor;}
+        static int twice(int n) {return n * 2;}
+    };
+
+    struct Other
+    {
+        int z = 0;
+    };
+
+    void declare()
+    {
+        ponder::Enum::declare<Color>("ExpectedTest::Color")
+            .value("Red", Color::Red)
+            .value("Green", Color::Green);
+
+        ponder::Class::declare<Point>("ExpectedTest::Point")
+            .constructor()
+            .constructor<int, int>()
+            .property("x", &Point::x)
+            .property("color", &Point::color)
+            .property("values", &Point::values)
+            .property("id", &Point::id)
+            .function("scale", &Point::scale)
+            .function("twice", &Point::twice);
+
+        ponder::Class::declare<Other>("ExpectedTest::Other")
+            .property("z", &Other::z);
+    }
+}
+
+PONDER_AUTO_TYPE(ExpectedTest::Color, &ExpectedTest::declare)
+PONDER_AUTO_TYPE(ExpectedTest::Point, &ExpectedTest::declare)
+PONDER_AUTO_TYPE(ExpectedTest::Other, &ExpectedTest::declare)
+
+// Report the error codes as numbers, rather than converting them to a Value.
+namespace Catch
+{
+    template <>
+    struct StringMaker<ponder::ErrorCode>
+    {
+        static std::string convert(ponder::ErrorCode code)
+        {
+            return std::to_string(static_cast<int>(code));
+        }
+    };
+}
+
+using namespace ExpectedTest;
+using ponder::ErrorCode;
+
+//-----------------------------------------------------------------------------
+//                         Tests for ponder::Expected
+//-----------------------------------------------------------------------------
+
+TEST_CASE("Expected holds a value or an error code")
+{
+    SECTION("value")
+    {
+        ponder::Expected<std::string> result(std::string("hello"));
+        REQUIRE(result.hasValue());
+        REQUIRE(static_cast<bool>(result));
+        REQUIRE(result.error() == ErrorCode::None);
+        REQUIRE(*result == "hello");
+        REQUIRE(result->size() == 5);
+        REQUIRE(result.valueOr("other") == "hello");
+        REQUIRE(std::move(result).value() == "hello");
+    }
+
+    SECTION("error")
+    {
+        ponder::Expected<int> result(ErrorCode::BadType);
+        REQUIRE_FALSE(result.hasValue());
+        REQUIRE_FALSE(static_cast<bool>(result));
+        REQUIRE(result.error() == ErrorCode::BadType);
+        REQUIRE(result.valueOr(3) == 3);
+    }
+
+    SECTION("void")
+    {
+        REQUIRE(ponder::Expected<void>().hasValue());
+        REQUIRE(ponder::Expected<void>().error() == ErrorCode::None);
+        REQUIRE_FALSE(ponder::Expected<void>(ErrorCode::ForbiddenWrite).hasValue());
+    }
+}
+
+TEST_CASE("Values are converted without throwing")
+{
+    ponder::enumByType<Color>(); // the conversions from names need the metaenum
+
+    SECTION("successful conversions")
+    {
+        REQUIRE(ponder::Value(12).tryTo<int>().value() == 12);
+        REQUIRE(ponder::Value("25").tryTo<int>().value() == 25);
+        REQUIRE(ponder::Value(25).tryTo<std::string>().value() == "25");
+        REQUIRE(ponder::Value("Green").tryTo<Color>().value() == Color::Green);
+        REQUIRE(ponder::Value(1).tryTo<Color>().value() == Color::Green);
+    }
+
+    SECTION("failed conversions")
+    {
+        REQUIRE(ponder::Value("abc").tryTo<int>().error() == ErrorCode::BadType);
+        REQUIRE(ponder::Value("1e999").tryTo<double>().error() == ErrorCode::BadType);
+        REQUIRE(ponder::Value("Blue").tryTo<Color>().error() == ErrorCode::BadType);
+        REQUIRE(ponder::Value().tryTo<int>().error() == ErrorCode::BadType);
+        REQUIRE(ponder::Value(Point()).tryTo<Other>().error() == ErrorCode::BadType);
+        REQUIRE(ponder::Value(12).tryTo<Point>().error() == ErrorCode::BadType);
+    }
+
+    SECTION("isCompatible agrees with to")
+    {
+        const ponder::Value values[] = {
+            ponder::Value(), ponder::Value(3), ponder::Value(true), ponder::Value(1.5),
+            ponder::Value("12"), ponder::Value("abc"), ponder::Value("true"),
+            ponder::Value("Red"), ponder::Value(Color::Green), ponder::Value(Point())
+        };
+        for (const ponder::Value& value : values)
+        {
+            REQUIRE(value.isCompatible<int>() == !!value.tryTo<int>());
+            REQUIRE(value.isCompatible<bool>() == !!value.tryTo<bool>());
+            REQUIRE(value.isCompatible<Color>() == !!value.tryTo<Color>());
+            REQUIRE(value.isCompatible<Point>() == !!value.tryTo<Point>());
+
+            if (value.isCompatible<int>())
+                REQUIRE_NOTHROW(value.to<int>());
+            else
+                REQUIRE_THROWS_AS(value.to<int>(), ponder::BadType);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+//                         Tests for properties
+//-----------------------------------------------------------------------------
+
+TEST_CASE("Properties are accessed without throwing")
+{
+    Point point(1, 2);
+    const ponder::UserObject object(&point);
+    const ponder::Class& metaclass = ponder::classByType<Point>();
+
+    SECTION("get")
+    {
+        REQUIRE(object.tryGet("x").value() == ponder::Value(1));
+        REQUIRE(object.tryGet("id").value() == ponder::Value(7));
+        REQUIRE(object.tryGet("unknown").error() == ErrorCode::PropertyNotFound);
+        REQUIRE(ponder::UserObject::nothing.tryGet("x").error() == ErrorCode::NullObject);
+
+        // Arrays give their first element
+        REQUIRE(object.tryGet("values").error() == ErrorCode::OutOfRange);
+        point.values.push_back(5);
+        REQUIRE(object.tryGet("values").value() == ponder::Value(5));
+    }
+
+    SECTION("set")
+    {
+        REQUIRE(object.trySet("x", 10).hasValue());
+        REQUIRE(point.x == 10);
+        REQUIRE(object.trySet("x", "20").hasValue());
+        REQUIRE(point.x == 20);
+        REQUIRE(object.trySet("color", "Green").hasValue());
+        REQUIRE(point.color == Color::Green);
+
+        REQUIRE(object.trySet("x", "abc").error() == ErrorCode::BadType);
+        REQUIRE(object.trySet("color", "Blue").error() == ErrorCode::BadType);
+        REQUIRE(object.trySet("id", 1).error() == ErrorCode::ForbiddenWrite);
+        REQUIRE(object.trySet("unknown", 1).error() == ErrorCode::PropertyNotFound);
+        REQUIRE(point.x == 20);
+        REQUIRE(point.color == Color::Green);
+    }
+
+    SECTION("object of another class")
+    {
+        Other other;
+        const ponder::UserObject otherObject(&other);
+        const ponder::Property& x = metaclass.property("x");
+        REQUIRE(x.tryGet(otherObject).error() == ErrorCode::ClassUnrelated);
+        REQUIRE(x.trySet(otherObject, 1).error() == ErrorCode::ClassUnrelated);
+        REQUIRE(other.z == 0);
+    }
+}
+
+//-----------------------------------------------------------------------------
+//                         Tests for functions
+//-----------------------------------------------------------------------------
+
+TEST_CASE("Functions are called without throwing")
+{
+    Point point(2, 0);
+    const ponder::UserObject object(&point);
+    const ponder::Class& metaclass = ponder::classByType<Point>();
+    const ponder::Function& scale = metaclass.function("scale");
+
+    SECTION("member function")
+    {
+        REQUIRE(ponder::runtime::tryCall(scale, object, 3).value() == ponder::Value(6));
+        REQUIRE(ponder::runtime::tryCall(scale, object, "2").value() == ponder::Value(12));
+
+        REQUIRE(ponder::runtime::tryCall(scale, object, "abc").error() == ErrorCode::BadArgument);
+        REQUIRE(ponder::runtime::tryCall(scale, object).error() == ErrorCode::NotEnoughArguments);
+        REQUIRE(ponder::runtime::tryCall(scale, ponder::UserObject::nothing, 2).error()
+                == ErrorCode::NullObject);
+        REQUIRE(point.x == 12);
+    }
+
+    SECTION("object of another class")
+    {
+        Other other;
+        REQUIRE(ponder::runtime::tryCall(scale, ponder::UserObject(&other), 2).error()
+                == ErrorCode::BadArgument);
+    }
+
+    SECTION("static function")
+    {
+        const ponder::Function& twice = metaclass.function("twice");
+        REQUIRE(ponder::runtime::tryCallStatic(twice, 4).value() == ponder::Value(8));
+        REQUIRE(ponder::runtime::tryCallStatic(twice, "x").error() == ErrorCode::BadArgument);
+        REQUIRE(ponder::runtime::tryCallStatic(twice).error() == ErrorCode::NotEnoughArguments);
+    }
+}
+
+TEST_CASE("Objects are created without throwing")
+{
+    const ponder::Class& metaclass = ponder::classByType<Point>();
+
+    ponder::Expected<ponder::UserObject> object = ponder::runtime::tryCreate(metaclass, 3, 4);
+    REQUIRE(object.hasValue());
+    REQUIRE(object->get<Point>().x == 3);
+    REQUIRE(object->get<Point>().y == 4);
+
+    REQUIRE(ponder::runtime::tryCreate(metaclass, 3).error() == ErrorCode::ConstructorNotFound);
+    REQUIRE(ponder::runtime::tryCreate(metaclass, "a", "b").error()
+            == ErrorCode::ConstructorNotFound);
+    REQUIRE(ponder::runtime::ObjectFactory(metaclass).tryConstruct().hasValue());
+}
+
+TEST_CASE("The error handler can be replaced")
+{
+    const ponder::ErrorHandler previous = ponder::setErrorHandler(nullptr);
+    REQUIRE(ponder::setErrorHandler(previous) == nullptr);
+}
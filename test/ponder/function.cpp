@@ -117,6 +117,8 @@ namespace FunctionTest
         void memberParams6(MyEnum, MyEnum, MyEnum, MyEnum, MyEnum) {}
 
         void ref(int& r) { r = p2; }
+
+        int plusP2(int x) const { return p2 + x; }
         
         struct Inner
         {
@@ -235,6 +237,7 @@ namespace FunctionTest
             .function("returnsPointer", &MyClass::returnsPointer, ponder::policy::ReturnInternalRef())
             .function("member3", &MyClass::member3) // inherited
             .function("member4", &MyClass::member4) // ponder::Value as return and parameter types
+            .function("plusP2", &MyClass::plusP2) // depends on the object
 
             // ***** parameters count ******
             .function("memberParams1", &MyClass::memberParams1)     // 0 parameter
@@ -276,6 +279,14 @@ namespace FunctionTest
 
             .function("nonCopyRef", &MyClass::staticFuncRetRef, ponder::policy::ReturnInternalRef())
             .function("nonCopyPtr", &MyClass::staticFuncRetPtr, ponder::policy::ReturnInternalRef())
+
+            // ***** template argument functions *****
+            .function<&nonMember2>("t_nonMember2")
+            .function<&MyClass::returnsConstRef>("t_returnsConstRef")
+            .function<&MyClass::returnsPointer>("t_returnsPointer", ponder::policy::ReturnInternalRef())
+            .function<&MyClass::member3>("t_member3") // inherited
+            .function<&MyClass::memberParams3>("t_memberParams3")
+            .function<&MyClass::staticFunc2>("t_nonClassFunc2")
             ;
 
         ponder::Class::declare<DataHolder>()
@@ -857,3 +868,167 @@ TEST_CASE("Functions can modify objects")
     REQUIRE(objectA.TestMember == 5);
 }
 
+TEST_CASE("Functions can be declared as template arguments")
+{
+    using ponder::Value;
+    using namespace ponder::runtime;
+
+    const ponder::Class& metaclass = ponder::classByType<MyClass>();
+    const ponder::Function& nonMember2 = metaclass.function("t_nonMember2");
+    const ponder::Function& returnsConstRef = metaclass.function("t_returnsConstRef");
+    const ponder::Function& returnsPointer = metaclass.function("t_returnsPointer");
+    const ponder::Function& member3 = metaclass.function("t_member3");
+    const ponder::Function& memberParams3 = metaclass.function("t_memberParams3");
+    const ponder::Function& nonClassFunc2 = metaclass.function("t_nonClassFunc2");
+
+    SECTION("introspection matches runtime declarations")
+    {
+        IS_TRUE(nonMember2.kind() == ponder::FunctionKind::Function);
+        IS_TRUE(returnsConstRef.kind() == ponder::FunctionKind::MemberFunction);
+        REQUIRE(nonMember2.returnType() == ponder::ValueKind::Integer);
+        REQUIRE(returnsConstRef.returnType() == ponder::ValueKind::User);
+        IS_TRUE(returnsPointer.returnPolicy() == ponder::policy::ReturnKind::InternalRef);
+        REQUIRE(memberParams3.paramCount() == 2);
+        REQUIRE(memberParams3.paramType(0) == ponder::ValueKind::Real);
+        REQUIRE(nonClassFunc2.paramCount() == 2);
+    }
+
+    SECTION("calls")
+    {
+        MyClass object;
+
+        REQUIRE(callStatic(nonMember2, &object, 10) == Value(12));
+        REQUIRE(call(returnsConstRef, &object).to<MyType>() == MyType(5));
+        REQUIRE(call(returnsPointer, &object).to<MyType*>() == object.m_pType);
+        REQUIRE(call(member3, &object) == Value::nothing);
+        REQUIRE(call(memberParams3, &object, 1.f, 2.0) == Value::nothing);
+        REQUIRE(callStatic(nonClassFunc2, 2.5f, 3.0f).to<float>() == 7.5f);
+    }
+
+    SECTION("arguments are checked")
+    {
+        MyClass object;
+
+        REQUIRE_THROWS_AS(callStatic(nonMember2, &object), ponder::NotEnoughArguments);
+        REQUIRE_THROWS_AS(callStatic(nonMember2, &object, MyType(1)), ponder::BadArgument);
+    }
+}
+
+TEST_CASE("Functions can be called with their native signature")
+{
+    using namespace ponder::runtime;
+
+    const ponder::Class& metaclass = ponder::classByType<MyClass>();
+    MyClass object;
+
+    SECTION("calls")
+    {
+        TypedCaller<int(MyClass&, int)> nonMember2(metaclass.function("nonMember2"));
+        REQUIRE(nonMember2(object, 10) == 12);
+        REQUIRE(nonMember2.call(object, 1) == 3);
+        REQUIRE(&nonMember2.function() == &metaclass.function("nonMember2"));
+
+        TypedCaller<const MyType&(const MyClass&)> returnsConstRef(metaclass.function("returnsConstRef"));
+        REQUIRE(&returnsConstRef(object) == &object.p5);
+
+        TypedCaller<void(MyClass&, float, double)> memberParams3(metaclass.function("memberParams3"));
+        memberParams3(object, 1.f, 2.0);
+
+        TypedCaller<void(MyBase&)> member3(metaclass.function("member3"));
+        member3(object);
+
+        TypedCaller<float(float, float)> nonClassFunc2(metaclass.function("nonClassFunc2"));
+        REQUIRE(nonClassFunc2(2.5f, 3.0f) == 7.5f);
+    }
+
+    SECTION("functions declared as template arguments")
+    {
+        TypedCaller<int(MyClass&, int)> nonMember2(metaclass.function("t_nonMember2"));
+        REQUIRE(nonMember2(object, 10) == 12);
+
+        TypedCaller<MyType*(const MyClass&)> returnsPointer(metaclass.function("t_returnsPointer"));
+        REQUIRE(returnsPointer(object) == object.m_pType);
+    }
+
+    SECTION("signature is checked at bind time")
+    {
+        typedef TypedCaller<int(MyClass&, int)> IntCaller;
+
+        // wrong arity
+        REQUIRE_THROWS_AS(TypedCaller<int(MyClass&)>(metaclass.function("nonMember2")),
+                          ponder::BadSignature);
+        REQUIRE_THROWS_AS(TypedCaller<void(MyClass&)>(metaclass.function("memberParams3")),
+                          ponder::BadSignature);
+
+        // wrong parameter kind
+        REQUIRE_THROWS_AS(TypedCaller<int(MyClass&, ponder::String)>(metaclass.function("nonMember2")),
+                          ponder::BadArgument);
+
+        // wrong return kind
+        REQUIRE_THROWS_AS(TypedCaller<float(MyClass&, int)>(metaclass.function("nonMember2")),
+                          ponder::BadType);
+
+        // same kinds, different C++ types
+        REQUIRE_THROWS_AS(TypedCaller<int(MyClass&, long)>(metaclass.function("nonMember2")),
+                          ponder::BadSignature);
+        REQUIRE_THROWS_AS(TypedCaller<void(MyClass&, double, double)>(metaclass.function("memberParams3")),
+                          ponder::BadSignature);
+
+        REQUIRE_NOTHROW(IntCaller(metaclass.function("nonMember2")));
+    }
+}
+
+TEST_CASE("Functions can be called on batches of objects")
+{
+    using ponder::Value;
+    using ponder::UserObject;
+
+    const ponder::Class& metaclass = ponder::classByType<MyClass>();
+    const ponder::Function& plusP2 = metaclass.function("plusP2");
+
+    MyClass objects[3];
+    std::vector<UserObject> batch;
+    for (int i = 0; i < 3; ++i)
+    {
+        objects[i].p2 = 10 * i;
+        batch.push_back(UserObject::makeRef(objects[i]));
+    }
+
+    SECTION("with the same arguments")
+    {
+        Value results[3];
+        ponder::runtime::callBatch(plusP2, batch.data(), batch.size(), ponder::Args(5), results);
+        REQUIRE(results[0] == Value(5));
+        REQUIRE(results[1] == Value(15));
+        REQUIRE(results[2] == Value(25));
+
+        ponder::runtime::ObjectCaller caller(metaclass.function("memberParams3"));
+        caller.callBatch(batch.data(), batch.size(), ponder::Args(1.f, 2.0));
+    }
+
+    SECTION("with arguments for each object")
+    {
+        const ponder::Args args[3] = {ponder::Args(1), ponder::Args(2), ponder::Args(3)};
+        Value results[3];
+        ponder::runtime::callBatch(plusP2, batch.data(), batch.size(), args, results);
+        REQUIRE(results[0] == Value(1));
+        REQUIRE(results[1] == Value(12));
+        REQUIRE(results[2] == Value(23));
+    }
+
+    SECTION("arguments and objects are checked")
+    {
+        REQUIRE_THROWS_AS(ponder::runtime::callBatch(plusP2, batch.data(), batch.size(),
+                                                     ponder::Args::empty),
+                          ponder::NotEnoughArguments);
+
+        const ponder::Args args[3] = {ponder::Args(1), ponder::Args(), ponder::Args(3)};
+        REQUIRE_THROWS_AS(ponder::runtime::callBatch(plusP2, batch.data(), batch.size(), args),
+                          ponder::NotEnoughArguments);
+
+        batch[1] = UserObject::nothing;
+        REQUIRE_THROWS_AS(ponder::runtime::callBatch(plusP2, batch.data(), batch.size(),
+                                                     ponder::Args(5)),
+                          ponder::NullObject);
+    }
+}
@@ -207,6 +207,30 @@ TEST_CASE("Classes support inheritence")
         REQUIRE(class4->property("p4").get(base4) == ponder::Value(40));
     }
 
+    SECTION("can be queried")
+    {
+        REQUIRE(class4->isA(*class4));
+        REQUIRE(class4->isA(*class3));
+        REQUIRE(class4->isA(*class2));
+        REQUIRE(class4->isA(*class1));
+        REQUIRE(class3->isA(*class4) == false);
+        REQUIRE(class1->isA(*class2) == false);
+
+        REQUIRE(class1->isBaseOf(*class4));
+        REQUIRE(class4->isBaseOf(*class1) == false);
+        REQUIRE(class2->isBaseOf(*class1) == false);
+    }
+
+    SECTION("cast through the hierarchy")
+    {
+        MyClass4 object4;
+        MyClass2* base2 = &object4;
+
+        REQUIRE(ponder::classCast(&object4, *class4, *class2) == base2);
+        REQUIRE(ponder::classCast(base2, *class2, *class4) == &object4);
+        REQUIRE_THROWS_AS(ponder::classCast(&object4, *class1, *class2), ponder::ClassUnrelated);
+    }
+
 //    SECTION("can override functions in derived class")
 //    {
 //        MyClass1 object1;
@@ -245,6 +269,24 @@ TEST_CASE("Classes support inheritence")
         REQUIRE(class1->property("overridden").get(object4) == ponder::Value(10));
         REQUIRE(class2->property("overridden").get(object4) == ponder::Value(20));
         REQUIRE(class3->property("overridden").get(object4) == ponder::Value(30));
-    }    
+    }
+
+    SECTION("checks the class of member handles")
+    {
+        MyClass2 object2;
+        MyClass4 object4;
+
+        // A handle from a base class gives the base's member, not the override
+        const ponder::PropertyHandle base = class1->propertyHandle("overridden");
+        REQUIRE(ponder::UserObject(&object4).get(base) == ponder::Value(10));
+        REQUIRE(&class4->function(class2->functionHandle("f2")) == &class2->function("f2"));
+
+        // Handles from unrelated classes are rejected, in release builds too
+        REQUIRE_THROWS_AS(ponder::UserObject(&object2).get(base), ponder::ClassUnrelated);
+        REQUIRE_THROWS_AS(ponder::UserObject(&object2).set(base, 1), ponder::ClassUnrelated);
+        REQUIRE_THROWS_AS(class2->function(class1->functionHandle("f1")),
+                          ponder::ClassUnrelated);
+        REQUIRE_THROWS_AS(class1->property(ponder::PropertyHandle()), ponder::PropertyNotFound);
+    }
 }
 
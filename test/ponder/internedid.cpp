@@ -0,0 +1,124 @@
+/****************************************************************************
+ **
+ ** This file is part of the Ponder library, formerly CAMP.
+ **
+ ** The MIT License (MIT)
+ **
+ ** Copyright (C) 2015-2020 Nick Trout.
+ **
+ ** Permission is hereby granted, free of charge, to any person obtaining a copy
+ ** of this software and associated documentation files (the "Software"), to deal
+ ** in the Software without restriction, including without limitation the rights
+ ** to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ ** copies of the Software, and to permit persons to whom the Software is
+ ** furnished to do so, subject to the following conditions:
+ **
+ ** The above copyright notice and this permission notice shall be included in
+ ** all copies or substantial portions of the Software.
+ **
+ ** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ ** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ ** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ ** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ ** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ ** OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ ** THE SOFTWARE.
+ **
+ ****************************************************************************/
+
+// Tests for interned identifiers, used by PONDER_ID_TRAITS_INTERNED.
+
+#include "test.hpp"
+#include <ponder/detail/internedid.hpp>
+#include <thread>
+#include <vector>
+
+using ponder::detail::InternedId;
+using ponder::detail::InternedRef;
+
+TEST_CASE("Interned ids share storage")
+{
+    SECTION("empty")
+    {
+        const InternedId id;
+        REQUIRE(id.empty());
+        REQUIRE(id.size() == 0);
+        REQUIRE(id.str() == "");
+        REQUIRE(InternedId("") == id);
+        REQUIRE(id.hash() == ponder::detail::hashString(""));
+    }
+
+    SECTION("equal names are the same id")
+    {
+        const std::string name("interned");
+        const InternedId a("interned"), b(name);
+        REQUIRE(a == b);
+        REQUIRE(a.c_str() == b.c_str());    // same storage
+        REQUIRE(a.str() == name);
+        REQUIRE(a.size() == name.size());
+        REQUIRE(a.hash() == ponder::detail::hashString(name));
+        REQUIRE(ponder::String(a) == name);
+    }
+
+    SECTION("different names are different ids")
+    {
+        const InternedId a("alpha"), b("bravo");
+        REQUIRE(a != b);
+        REQUIRE(a < b);
+        REQUIRE(b > a);
+        REQUIRE(a.compare(b) < 0);
+        REQUIRE(a.compare(a) == 0);
+    }
+
+    SECTION("can be found without interning")
+    {
+        const std::size_t count = InternedId::symbolCount();
+        REQUIRE(InternedId::find("never-interned-name").empty());
+        REQUIRE(InternedId::symbolCount() == count);
+
+        const InternedId id("found");
+        REQUIRE(InternedId::find("found") == id);
+    }
+
+    SECTION("references do not intern")
+    {
+        const std::size_t count = InternedId::symbolCount();
+        const InternedRef ref("never-interned-ref");
+        REQUIRE(ref.size() == 18);
+        REQUIRE(ref.hash() == ponder::detail::hashString("never-interned-ref"));
+        REQUIRE(ref.find().empty());
+        REQUIRE(ref != InternedRef(InternedId("interned")));
+        REQUIRE(InternedId::symbolCount() == count);
+
+        const InternedId id("referenced");
+        const std::size_t interned = InternedId::symbolCount();
+        REQUIRE(InternedRef("referenced") == InternedRef(id));
+        REQUIRE(InternedRef(std::string("referenced")) == InternedRef("referenced"));
+        REQUIRE(InternedRef("referenced").find() == id);
+        REQUIRE(InternedRef("alpha") < InternedRef(id));
+        REQUIRE(InternedId::symbolCount() == interned);
+
+        // Storing a reference as an id interns it.
+        REQUIRE(InternedId(InternedRef("referenced")) == id);
+        REQUIRE(InternedId(InternedRef(id)) == id);
+    }
+
+    SECTION("can be interned from many threads")
+    {
+        std::vector<InternedId> ids(8);
+        std::vector<std::thread> threads;
+        for (std::size_t i = 0; i < ids.size(); ++i)
+        {
+            threads.emplace_back([&ids, i]() {
+                for (int j = 0; j < 1000; ++j)
+                    InternedId("thread" + std::to_string(j));
+                ids[i] = InternedId("threaded");
+            });
+        }
+        for (auto& t : threads)
+            t.join();
+
+        for (auto const& id : ids)
+            REQUIRE(id == ids[0]);
+    }
+}
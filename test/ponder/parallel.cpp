@@ -0,0 +1,202 @@
+/****************************************************************************
+ **
+ ** This file is part of the Ponder library, formerly CAMP.
+ **
+ ** The MIT License (MIT)
+ **
+ ** Copyright (C) 2009-2010 TECHNOGERMA Systems France and/or its subsidiary(-ies).
+ ** Copyright (C) 2015-2020 Nick Trout.
+ **
+ ** Permission is hereby granted, free of charge, to any person obtaining a copy
+ ** of this software and associated documentation files (the "Software"), to deal
+ ** in the Software without restriction, including without limitation the rights
+ ** to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ ** copies of the Software, and to permit persons to whom the Software is
+ ** furnished to do so, subject to the following conditions:
+ **
+ ** The above copyright notice and this permission notice shall be included in
+ ** all copies or substantial portions of the Software.
+ **
+ ** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ ** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ ** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ ** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ ** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ ** OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ ** THE SOFTWARE.
+ **
+ ****************************************************************************/
+
+// Tests for ponder::parallel.
+
+#include <ponder/classbuilder.hpp>
+#include <ponder/uses/parallel.hpp>
+#include "test.hpp"
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+namespace ParallelTest
+{
+    struct Particle
+    {
+        int position = 0;
+        int speed = 0;
+
+        int step(int dt) {return position += speed * dt;}
+        void fail() {throw std::runtime_error("fail");}
+    };
+
+    void declare()
+    {
+        ponder::Class::declare<Particle>()
+            .property("speed", &Particle::speed)
+            .function("step", &Particle::step)
+            .function("fail", &Particle::fail);
+    }
+
+    struct Particles
+    {
+        Particles(size_t count) : particles(count)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                particles[i].speed = static_cast<int>(i);
+                objects.push_back(ponder::UserObject::makeRef(particles[i]));
+            }
+        }
+
+        std::vector<Particle> particles;
+        std::vector<ponder::UserObject> objects;
+    };
+}
+
+PONDER_AUTO_TYPE(ParallelTest::Particle, &ParallelTest::declare)
+
+using namespace ParallelTest;
+
+//-----------------------------------------------------------------------------
+//                         Tests for ponder::parallel
+//-----------------------------------------------------------------------------
+
+TEST_CASE("Thread pools run loops in parallel")
+{
+    ponder::parallel::ThreadPool pool(3);
+    REQUIRE(pool.workerCount() == 3);
+
+    SECTION("each index is visited once")
+    {
+        for (size_t count : {0, 1, 5, 1000, 100003})
+        {
+            // Catch assertions aren't thread safe, check after the loop
+            std::vector<std::atomic<int>> visits(count);
+            std::atomic<bool> emptyShard{false};
+            pool.forRange(count, 16, [&](size_t begin, size_t end)
+            {
+                emptyShard = emptyShard || begin >= end;
+                for (size_t i = begin; i < end; ++i)
+                    ++visits[i];
+            });
+            REQUIRE(!emptyShard);
+            size_t visitedOnce = 0;
+            for (size_t i = 0; i < count; ++i)
+                visitedOnce += visits[i] == 1 ? 1 : 0;
+            REQUIRE(visitedOnce == count);
+        }
+    }
+
+    SECTION("loops can be nested")
+    {
+        std::atomic<size_t> total{0};
+        pool.forRange(100, 1, [&](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                pool.forRange(100, 1, [&](size_t b, size_t e) {total += e - b;});
+            }
+        });
+        REQUIRE(total == 100 * 100);
+    }
+
+    SECTION("errors are rethrown")
+    {
+        REQUIRE_THROWS_AS(pool.forRange(1000, 1, [](size_t begin, size_t)
+        {
+            if (begin > 500)
+                throw std::runtime_error("error");
+        }), std::runtime_error);
+    }
+
+    SECTION("tasks are run")
+    {
+        std::atomic<int> done{0};
+        for (int i = 0; i < 100; ++i)
+            pool.submit([&done] {++done;});
+        while (pool.runPendingTask())
+        {
+        }
+        while (done != 100)
+            std::this_thread::yield();
+        REQUIRE(done == 100);
+    }
+
+    SECTION("pools without workers run on the calling thread")
+    {
+        ponder::parallel::ThreadPool inline_(0);
+        const std::thread::id caller = std::this_thread::get_id();
+        std::atomic<bool> sameThread{true};
+        inline_.forRange(1000, 1, [&](size_t, size_t)
+        {
+            sameThread = sameThread && std::this_thread::get_id() == caller;
+        });
+        inline_.submit([&] {sameThread = sameThread && std::this_thread::get_id() == caller;});
+        REQUIRE(sameThread);
+    }
+}
+
+TEST_CASE("Reflected calls can be run in parallel")
+{
+    const ponder::Class& metaclass = ponder::classByType<Particle>();
+    ponder::parallel::ThreadPool pool(3);
+    Particles particles(1000);
+
+    SECTION("functions")
+    {
+        std::vector<ponder::Value> results(particles.objects.size());
+        ponder::parallel::forEach(pool, particles.objects.data(), particles.objects.size(),
+                                  metaclass.function("step"), ponder::Args(2), results.data());
+        for (size_t i = 0; i < particles.particles.size(); i += 99)
+        {
+            REQUIRE(particles.particles[i].position == 2 * static_cast<int>(i));
+            REQUIRE(results[i] == ponder::Value(2 * static_cast<int>(i)));
+        }
+
+        ponder::parallel::forEach(particles.objects.data(), particles.objects.size(),
+                                  metaclass.function("step"), ponder::Args(1));
+        REQUIRE(particles.particles[10].position == 30);
+    }
+
+    SECTION("properties")
+    {
+        ponder::parallel::forEach(pool, particles.objects.data(), particles.objects.size(),
+                                  metaclass.property("speed"), 7);
+        for (const Particle& particle : particles.particles)
+            REQUIRE(particle.speed == 7);
+
+        ponder::parallel::forEach(particles.objects.data(), particles.objects.size(),
+                                  metaclass.property("speed"), 8);
+        REQUIRE(particles.particles.back().speed == 8);
+    }
+
+    SECTION("errors")
+    {
+        REQUIRE_THROWS_AS(ponder::parallel::forEach(pool, particles.objects.data(),
+                                                    particles.objects.size(),
+                                                    metaclass.function("fail")),
+                          std::runtime_error);
+        REQUIRE_THROWS_AS(ponder::parallel::forEach(pool, particles.objects.data(),
+                                                    particles.objects.size(),
+                                                    metaclass.function("step")),
+                          ponder::NotEnoughArguments);
+    }
+}
@@ -0,0 +1,182 @@
+/****************************************************************************
+ **
+ ** This file is part of the Ponder library, formerly CAMP.
+ **
+ ** The MIT License (MIT)
+ **
+ ** Copyright (C) 2009-2010 TECHNOGERMA Systems France and/or its subsidiary(-ies).
+ ** Copyright (C) 2015-2020 Nick Trout.
+ **
+ ** Permission is hereby granted, free of charge, to any person obtaining a copy
+ ** of this software and associated documentation files (the "Software"), to deal
+ ** in the Software without restriction, including without limitation the rights
+ ** to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ ** copies of the Software, and to permit persons to whom the Software is
+ ** furnished to do so, subject to the following conditions:
+ **
+ ** The above copyright notice and this permission notice shall be included in
+ ** all copies or substantial portions of the Software.
+ **
+ ** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ ** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ ** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ ** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ ** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ ** OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ ** THE SOFTWARE.
+ **
+ ****************************************************************************/
+
+// Tests for ponder::profiling. These are built as pondertest_profiling, with PONDER_PROFILING,
+// so the functions declared here are measured.
+
+#include <ponder/classbuilder.hpp>
+#include <ponder/uses/runtime.hpp>
+#include "test.hpp"
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+namespace ProfilingTest
+{
+    struct Timed
+    {
+        int total = 0;
+
+        int add(int n) {return total += n;}
+        void fail() {throw std::runtime_error("fail");}
+        void unused() {}
+    };
+
+    void declare()
+    {
+        ponder::Class::declare<Timed>()
+            .function("add", &Timed::add)
+            .function("fail", &Timed::fail)
+            .function("unused", &Timed::unused);
+    }
+}
+
+PONDER_AUTO_TYPE(ProfilingTest::Timed, &ProfilingTest::declare)
+
+using namespace ProfilingTest;
+
+//-----------------------------------------------------------------------------
+//                         Tests for ponder::profiling
+//-----------------------------------------------------------------------------
+
+TEST_CASE("Histograms count latencies in logarithmic buckets")
+{
+    using ponder::profiling::Histogram;
+
+    SECTION("small values are exact")
+    {
+        for (std::uint64_t v = 0; v < 32; ++v)
+        {
+            REQUIRE(Histogram::bucketIndex(v) == v);
+            REQUIRE(Histogram::bucketMax(v) == v);
+        }
+    }
+
+    SECTION("buckets bound their values closely")
+    {
+        size_t previous = 0;
+        for (std::uint64_t v = 1; v < Histogram::maxValue; v += v / 7 + 1)
+        {
+            const size_t index = Histogram::bucketIndex(v);
+            REQUIRE(index < Histogram::bucketCount);
+            REQUIRE(index >= previous);
+            REQUIRE(Histogram::bucketMax(index) >= v);
+            REQUIRE(Histogram::bucketMax(index) - v <= v / 16);
+            if (index > 0)
+                REQUIRE(Histogram::bucketMax(index - 1) < v);
+            previous = index;
+        }
+
+        REQUIRE(Histogram::bucketIndex(Histogram::maxValue) == Histogram::bucketCount - 1);
+        REQUIRE(Histogram::bucketIndex(~std::uint64_t(0)) == Histogram::bucketCount - 1);
+        REQUIRE(Histogram::bucketMax(Histogram::bucketCount - 1) == Histogram::maxValue);
+    }
+
+    SECTION("percentiles")
+    {
+        Histogram histogram;
+        REQUIRE(histogram.count() == 0);
+        REQUIRE(histogram.percentile(50) == 0);
+
+        for (std::uint64_t v = 1; v <= 10; ++v)
+            histogram.record(v);
+        histogram.record(1000);
+        REQUIRE(histogram.count() == 11);
+        REQUIRE(histogram.percentile(0) == 1);
+        REQUIRE(histogram.percentile(50) == 6);
+        REQUIRE(histogram.percentile(90) == 10);
+        REQUIRE(histogram.percentile(100) >= 1000);
+        REQUIRE(histogram.percentile(100) <= 1000 + 1000 / 16);
+
+        Histogram other;
+        other.record(3);
+        other.merge(histogram);
+        REQUIRE(other.count() == 12);
+        REQUIRE(other.bucketCountAt(3) == 2);
+    }
+}
+
+TEST_CASE("Function calls are profiled")
+{
+    const ponder::Class& metaclass = ponder::classByType<Timed>();
+    const ponder::Function& add = metaclass.function("add");
+    const ponder::Function& fail = metaclass.function("fail");
+    Timed timed;
+    const ponder::UserObject object(&timed);
+
+    const ponder::profiling::FunctionStats before = add.stats();
+    const ponder::profiling::FunctionStats failBefore = fail.stats();
+
+    SECTION("calls and exceptions are counted")
+    {
+        for (int i = 0; i < 10; ++i)
+            ponder::runtime::call(add, object, i);
+        REQUIRE_THROWS_AS(ponder::runtime::call(fail, object), std::runtime_error);
+
+        const ponder::profiling::FunctionStats stats = add.stats();
+        REQUIRE(stats.calls == before.calls + 10);
+        REQUIRE(stats.exceptions == before.exceptions);
+        REQUIRE(stats.latency.count() == stats.calls);
+        REQUIRE(stats.totalNs >= before.totalNs);
+
+        const ponder::profiling::FunctionStats failStats = fail.stats();
+        REQUIRE(failStats.calls == failBefore.calls + 1);
+        REQUIRE(failStats.exceptions == failBefore.exceptions + 1);
+
+        REQUIRE(metaclass.function("unused").stats().calls == 0);
+    }
+
+    SECTION("calls of all the threads are merged")
+    {
+        std::thread thread([&]
+        {
+            Timed local;
+            for (int i = 0; i < 100; ++i)
+                ponder::runtime::call(add, ponder::UserObject(&local), i);
+        });
+        thread.join();
+        ponder::runtime::call(add, object, 1);
+
+        REQUIRE(add.stats().calls == before.calls + 101);
+    }
+
+    SECTION("report")
+    {
+        ponder::runtime::call(add, object, 1);
+
+        std::ostringstream report;
+        ponder::profiling::dump(report);
+        const std::string json = report.str();
+        REQUIRE(json.find("{\"functions\": [") == 0);
+        REQUIRE(json.find("{\"class\": \"ProfilingTest::Timed\", \"function\": \"add\", "
+                          "\"calls\": ") != std::string::npos);
+        REQUIRE(json.find("\"function\": \"unused\"") == std::string::npos);
+        REQUIRE(json.find("\"p99Ns\": ") != std::string::npos);
+    }
+}
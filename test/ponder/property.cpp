@@ -129,12 +129,28 @@ namespace PropertyTest
         .property("l_rw_" #N, [](MyClass& c) -> T& {return c.N;}) /* rw lambda */ \
         .property("l_gs_" #N, [](const MyClass& c) {return c.N;}, [](MyClass& c, T v) {c.N = v;}) /* g lambda */
 
+#define STATIC_PROPERTY(N) \
+        .property<&MyClass::N>("t_m_" #N) /* member object */ \
+        .property<&MyClass::r_##N>("t_mf_r_" #N) /* ro member func*/ \
+        .property<&MyClass::rw_##N>("t_mf_rw_" #N) /* rw member func*/ \
+        .property<&MyClass::r_##N, &MyClass::w_##N>("t_mf_gs_" #N) /* get/set member func*/ \
+        .property<&r_##N>("t_f_r_" #N) /* ro function */ \
+        .property<&rw_##N>("t_f_rw_" #N) /* rw function */ \
+        .property<&r_##N, &w_##N>("t_f_gs_" #N) /* get/set function */
+
         ponder::Class::declare<MyClass>("PropertyTest::MyClass")
             PROPERTY(bool,b)
             PROPERTY(int,i)
             PROPERTY(float,f)
             PROPERTY(std::string,s)
             PROPERTY(MyEnum,e)
+            STATIC_PROPERTY(b)
+            STATIC_PROPERTY(i)
+            STATIC_PROPERTY(f)
+            STATIC_PROPERTY(s)
+            STATIC_PROPERTY(e)
+            .property<&MyClass::getCT>("t_getCT")
+            .property<&MyClass::getCT, &MyClass::setT>("t_myType")
             .property("getCT", &MyClass::getCT)
             .property("getT", &MyClass::getT)
             .property("myType", &MyClass::getCT, &MyClass::setT)
@@ -307,3 +323,179 @@ TEST_CASE("Classes can have properties")
 }
 
 
+
+TEST_CASE("Properties can be accessed by type")
+{
+    const ponder::Class& metaclass = ponder::classByType<MyClass>();
+
+    SECTION("get")
+    {
+        MyClass c;
+        c.b = true;
+        c.i = 77;
+        c.f = 34.5f;
+        c.s = "Woo!";
+        ponder::UserObject object(&c);
+
+#define CHECK_PROP_GET_AS(T,N) \
+        REQUIRE(metaclass.property("m_" #N).getAs<T>(object) == c.N); \
+        REQUIRE(metaclass.property("mf_r_" #N).getAs<T>(object) == c.N); \
+        REQUIRE(metaclass.property("mf_rw_" #N).getAs<T>(object) == c.N); \
+        REQUIRE(metaclass.property("mf_gs_" #N).getAs<T>(object) == c.N); \
+        REQUIRE(metaclass.property("f_r_" #N).getAs<T>(object) == c.N); \
+        REQUIRE(metaclass.property("f_rw_" #N).getAs<T>(object) == c.N); \
+        REQUIRE(metaclass.property("f_gs_" #N).getAs<T>(object) == c.N); \
+        REQUIRE(metaclass.property("l_r_" #N).getAs<T>(object) == c.N); \
+        REQUIRE(metaclass.property("l_rw_" #N).getAs<T>(object) == c.N); \
+        REQUIRE(metaclass.property("l_gs_" #N).getAs<T>(object) == c.N);
+
+        CHECK_PROP_GET_AS(bool,b);
+        CHECK_PROP_GET_AS(int,i);
+        CHECK_PROP_GET_AS(float,f);
+        CHECK_PROP_GET_AS(std::string,s);
+    }
+
+    SECTION("set")
+    {
+#define CHECK_PROP_SET_AS_PASS(NAME,T,N,V) \
+    {   MyClass object; \
+        REQUIRE(object.N != V); \
+        metaclass.property(NAME).setAs<T>(&object, V); \
+        REQUIRE(object.N == V); \
+    }
+
+#define CHECK_PROP_SET_AS_FAIL(NAME,T,N,V) \
+    {   MyClass object; \
+        REQUIRE_THROWS_AS(metaclass.property(NAME).setAs<T>(&object, V), ponder::ForbiddenWrite); \
+    }
+
+#define CHECK_PROP_SET_AS(T,N,V) \
+        CHECK_PROP_SET_AS_PASS("m_" #N, T, N, V); \
+        CHECK_PROP_SET_AS_FAIL("mf_r_" #N, T, N, V); \
+        CHECK_PROP_SET_AS_PASS("mf_rw_" #N, T, N, V); \
+        CHECK_PROP_SET_AS_PASS("mf_gs_" #N, T, N, V); \
+        CHECK_PROP_SET_AS_FAIL("f_r_" #N, T, N, V); \
+        CHECK_PROP_SET_AS_PASS("f_rw_" #N, T, N, V); \
+        CHECK_PROP_SET_AS_PASS("f_gs_" #N, T, N, V); \
+        CHECK_PROP_SET_AS_FAIL("l_r_" #N, T, N, V); \
+        CHECK_PROP_SET_AS_PASS("l_rw_" #N, T, N, V); \
+        CHECK_PROP_SET_AS_PASS("l_gs_" #N, T, N, V)
+
+        CHECK_PROP_SET_AS(bool,b,true);
+        CHECK_PROP_SET_AS(int,i,789);
+        CHECK_PROP_SET_AS(float,f,345.75f);
+        CHECK_PROP_SET_AS(std::string,s,std::string("The Reverend Black Grape"));
+    }
+
+    SECTION("bound reference")
+    {
+        MyClass c;
+        const ponder::TypedPropertyRef<int> ref = metaclass.property("mf_gs_i").typed<int>();
+        REQUIRE(&ref.property() == &metaclass.property("mf_gs_i"));
+
+        ref.set(&c, 12);
+        REQUIRE(c.i == 12);
+        REQUIRE(ref.get(&c) == 12);
+    }
+
+    SECTION("type is checked when bound")
+    {
+        const ponder::Property& prop = metaclass.property("m_i");
+        REQUIRE_THROWS_AS(prop.typed<float>(), ponder::BadType);
+        REQUIRE_THROWS_AS(prop.typed<long>(), ponder::BadType);
+        REQUIRE_THROWS_AS(metaclass.property("m_f").typed<int>(), ponder::BadType);
+
+        // Only simple properties can be accessed by type.
+        REQUIRE_THROWS_AS(metaclass.property("m_e").typed<MyEnum>(), ponder::BadType);
+    }
+
+    SECTION("null object")
+    {
+        const ponder::Property& prop = metaclass.property("m_i");
+        REQUIRE_THROWS_AS(prop.getAs<int>(ponder::UserObject::nothing), ponder::NullObject);
+        REQUIRE_THROWS_AS(prop.setAs<int>(ponder::UserObject::nothing, 1), ponder::NullObject);
+    }
+}
+
+TEST_CASE("Properties can be declared with compile time accessors")
+{
+    const ponder::Class& metaclass = ponder::classByType<MyClass>();
+
+#define FOR_STATIC_PROPS(CHECK, N, ...) \
+        CHECK("t_m_" #N, true, N, __VA_ARGS__); \
+        CHECK("t_mf_r_" #N, false, N, __VA_ARGS__); \
+        CHECK("t_mf_rw_" #N, true, N, __VA_ARGS__); \
+        CHECK("t_mf_gs_" #N, true, N, __VA_ARGS__); \
+        CHECK("t_f_r_" #N, false, N, __VA_ARGS__); \
+        CHECK("t_f_rw_" #N, true, N, __VA_ARGS__); \
+        CHECK("t_f_gs_" #N, true, N, __VA_ARGS__)
+
+    SECTION("type")
+    {
+#define CHECK_STATIC_PROP_TYPE(NAME, W, N, T) \
+        REQUIRE(metaclass.property(NAME).kind() == T); \
+        REQUIRE(metaclass.property(NAME).isReadable() == true); \
+        REQUIRE(metaclass.property(NAME).isWritable() == W)
+
+        FOR_STATIC_PROPS(CHECK_STATIC_PROP_TYPE, b, ponder::ValueKind::Boolean);
+        FOR_STATIC_PROPS(CHECK_STATIC_PROP_TYPE, i, ponder::ValueKind::Integer);
+        FOR_STATIC_PROPS(CHECK_STATIC_PROP_TYPE, f, ponder::ValueKind::Real);
+        FOR_STATIC_PROPS(CHECK_STATIC_PROP_TYPE, s, ponder::ValueKind::String);
+        FOR_STATIC_PROPS(CHECK_STATIC_PROP_TYPE, e, ponder::ValueKind::Enum);
+        REQUIRE(metaclass.property("t_getCT").kind() == ponder::ValueKind::User);
+        REQUIRE(metaclass.property("t_myType").isWritable() == true);
+    }
+
+    SECTION("get")
+    {
+        MyClass c;
+        c.b = true;
+        c.i = 77;
+        c.f = 34.5f;
+        c.s = "Woo!";
+        c.e = One;
+        ponder::UserObject object(&c);
+
+#define CHECK_STATIC_PROP_GET(NAME, W, N, T) \
+        REQUIRE(metaclass.property(NAME).get(object).to<T>() == c.N)
+
+        FOR_STATIC_PROPS(CHECK_STATIC_PROP_GET, b, bool);
+        FOR_STATIC_PROPS(CHECK_STATIC_PROP_GET, i, int);
+        FOR_STATIC_PROPS(CHECK_STATIC_PROP_GET, f, float);
+        FOR_STATIC_PROPS(CHECK_STATIC_PROP_GET, s, std::string);
+        FOR_STATIC_PROPS(CHECK_STATIC_PROP_GET, e, MyEnum);
+        REQUIRE(metaclass.property("t_m_i").getAs<int>(object) == 77);
+    }
+
+    SECTION("set")
+    {
+#define CHECK_STATIC_PROP_SET(NAME, W, N, V) \
+    {   MyClass object; \
+        if (W) { \
+            metaclass.property(NAME).set(&object, V); \
+            REQUIRE(object.N == V); \
+        } else { \
+            REQUIRE_THROWS_AS(metaclass.property(NAME).set(&object, V), ponder::ForbiddenWrite); \
+        } \
+    }
+
+        FOR_STATIC_PROPS(CHECK_STATIC_PROP_SET, b, true);
+        FOR_STATIC_PROPS(CHECK_STATIC_PROP_SET, i, 789);
+        FOR_STATIC_PROPS(CHECK_STATIC_PROP_SET, f, 345.75f);
+        FOR_STATIC_PROPS(CHECK_STATIC_PROP_SET, s, std::string("The Reverend Black Grape"));
+        FOR_STATIC_PROPS(CHECK_STATIC_PROP_SET, e, Two);
+
+        MyClass object;
+        metaclass.property("t_mf_gs_i").setAs<int>(&object, 5);
+        REQUIRE(object.i == 5);
+    }
+
+    SECTION("user objects")
+    {
+        MyClass c;
+        MyType t(23);
+        metaclass.property("t_myType").set(&c, &t);
+        REQUIRE(c.mt.x == 23);
+        REQUIRE(metaclass.property("t_getCT").get(&c).to<MyType>().x == 23);
+    }
+}
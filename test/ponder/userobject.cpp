@@ -32,8 +32,13 @@
 
 #include <ponder/classbuilder.hpp>
 #include <ponder/uses/runtime.hpp>
+#include <ponder/uses/async.hpp>
 #include "test.hpp"
+#include <atomic>
 #include <ostream>
+#include <cstdlib>
+#include <new>
+#include <memory_resource>
 
 #if 0
 static bool g_log = false;
@@ -78,6 +83,7 @@ namespace UserObjectTest
 
         int x;
         int f() const {return x;}
+        void inc() {++x;}
         PONDER_POLYMORPHIC();
     };
 
@@ -198,6 +204,40 @@ namespace UserObjectTest
     int MoveableClass::assignMove{};
     int MoveableClass::destruct{};
 
+    struct Pooled
+    {
+        int x = 0;
+        double y = 0.0;
+    };
+
+    // Too aligned for the pool blocks, so allocated from the upstream resource.
+    struct alignas(64) OverAligned
+    {
+        int x = 0;
+    };
+
+    // Memory resource counting the allocations made through it.
+    class CountingResource : public std::pmr::memory_resource
+    {
+    public:
+        size_t allocated = 0, deallocated = 0;
+    private:
+        void* do_allocate(std::size_t bytes, std::size_t align) override
+        {
+            ++allocated;
+            return std::pmr::new_delete_resource()->allocate(bytes, align);
+        }
+        void do_deallocate(void* p, std::size_t bytes, std::size_t align) override
+        {
+            ++deallocated;
+            std::pmr::new_delete_resource()->deallocate(p, bytes, align);
+        }
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+        {
+            return this == &other;
+        }
+    };
+
     void declare()
     {
         ponder::Class::declare<MyBase>();
@@ -205,7 +245,8 @@ namespace UserObjectTest
             .base<MyBase>()
             .constructor<int>()
             .property("p", &MyClass::x)
-            .function("f", &MyClass::f);
+            .function("f", &MyClass::f)
+            .function("inc", &MyClass::inc);
 
         ponder::Class::declare<MyNonCopyableClass>();
 
@@ -252,6 +293,30 @@ PONDER_AUTO_TYPE(UserObjectTest::Data, &UserObjectTest::declare)
 PONDER_AUTO_TYPE(UserObjectTest::Renamed, &UserObjectTest::declare)
 PONDER_TYPE(UserObjectTest::DefaultClass);
 PONDER_TYPE(UserObjectTest::MoveableClass);
+PONDER_TYPE(UserObjectTest::Pooled);
+PONDER_TYPE(UserObjectTest::OverAligned);
+
+// Count heap allocations, to check which user objects allocate. Also used by args.cpp.
+// Atomic as parallel.cpp allocates from worker threads.
+std::atomic<size_t> g_allocCount{0};
+
+void* operator new(std::size_t size)
+{
+    ++g_allocCount;
+    if (void* p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
 
 using namespace UserObjectTest;
 
@@ -402,6 +467,194 @@ TEST_CASE("User objects can be copied")
     }
 }
 
+TEST_CASE("User object references do not allocate")
+{
+    MyClass object(6);
+    const MyClass& constObject = object;
+    ponder::classByType<MyClass>(); // declare before counting
+
+    SECTION("references are inline")
+    {
+        const size_t before = g_allocCount;
+        ponder::UserObject ref = ponder::UserObject::makeRef(object);
+        ponder::UserObject constRef = ponder::UserObject::makeRef(constObject);
+        ponder::UserObject ptr(&object);
+        ponder::UserObject copied(ref);
+        ponder::UserObject moved(std::move(copied));
+        REQUIRE(g_allocCount == before);
+
+        REQUIRE(ref.pointer() == &object);
+        REQUIRE(constRef.pointer() == &object);
+        REQUIRE(ptr == ref);
+        REQUIRE(moved == ref);
+        REQUIRE(copied == ponder::UserObject::nothing);
+    }
+
+    SECTION("copies are owned")
+    {
+        ponder::UserObject copy = ponder::UserObject::makeCopy(object);
+        REQUIRE(copy.pointer() != &object);
+
+        const size_t before = g_allocCount;
+        ponder::UserObject shared(copy);
+        REQUIRE(g_allocCount == before);
+        REQUIRE(shared == copy);
+    }
+}
+
+TEST_CASE("Owned user objects are allocated from the class memory resource")
+{
+    CountingResource resource;
+    ponder::Class::declare<Pooled>().memoryResource(&resource);
+    auto const& metaclass = ponder::classByType<Pooled>();
+    REQUIRE(metaclass.memoryResource() == &resource);
+
+    Pooled object;
+    object.x = 3;
+
+    SECTION("copies are a single allocation")
+    {
+        {
+            const size_t before = g_allocCount;
+            ponder::UserObject copy = ponder::UserObject::makeCopy(object);
+            REQUIRE(g_allocCount == before);
+            REQUIRE(resource.allocated == 1);
+            REQUIRE(copy.get<Pooled>().x == 3);
+
+            ponder::UserObject owned = ponder::UserObject::makeOwned(Pooled(object));
+            REQUIRE(resource.allocated == 2);
+        }
+        REQUIRE(resource.deallocated == 2);
+    }
+
+    SECTION("references do not use the resource")
+    {
+        ponder::UserObject ref = ponder::UserObject::makeRef(object);
+        REQUIRE(resource.allocated == 0);
+    }
+
+    SECTION("default is a class pool")
+    {
+        ponder::Class::undeclare<Pooled>();
+        ponder::Class::declare<Pooled>();
+        auto const& pooled = ponder::classByType<Pooled>();
+        REQUIRE(pooled.memoryResource() != nullptr);
+        REQUIRE(pooled.memoryResource() != &resource);
+
+        ponder::UserObject copy = ponder::UserObject::makeCopy(object);
+        REQUIRE(copy.get<Pooled>().x == 3);
+        REQUIRE(resource.allocated == 0);
+
+        // The pool outlives the metaclass while objects use it.
+        ponder::Class::undeclare<Pooled>();
+        REQUIRE(copy.cref<Pooled>().x == 3);
+        copy = ponder::UserObject::nothing;
+        ponder::Class::declare<Pooled>();
+    }
+
+    ponder::Class::undeclare<Pooled>();
+}
+
+TEST_CASE("Objects from the upstream resource can outlive their class pool")
+{
+    CountingResource resource;
+    std::pmr::memory_resource* previous = std::pmr::set_default_resource(&resource);
+    ponder::Class::declare<OverAligned>();
+    std::pmr::set_default_resource(previous);
+
+    OverAligned object;
+    object.x = 5;
+    ponder::UserObject copy = ponder::UserObject::makeCopy(object);
+    REQUIRE(resource.allocated == 1);
+
+    // The pool is kept alive by the upstream block and returns it when it is freed.
+    ponder::Class::undeclare<OverAligned>();
+    REQUIRE(copy.cref<OverAligned>().x == 5);
+    REQUIRE(resource.deallocated == 0);
+    copy = ponder::UserObject::nothing;
+    REQUIRE(resource.deallocated == 1);
+}
+
+TEST_CASE("User objects can be copied on write")
+{
+    MyClass object(8);
+    const ponder::UserObject cow = ponder::UserObject::makeCopyOnWrite(object);
+    REQUIRE(cow.pointer() != &object);
+    REQUIRE(cow.get("p") == ponder::Value(8));
+
+    SECTION("copies share the object until written")
+    {
+        ponder::UserObject copy(cow);
+        REQUIRE(copy == cow);
+
+        copy.set("p", 9);
+        REQUIRE(copy != cow);
+        REQUIRE(copy.get("p") == ponder::Value(9));
+        REQUIRE(cow.get("p") == ponder::Value(8));
+        REQUIRE(object.x == 8);
+    }
+
+    SECTION("copies are detached by mutable references")
+    {
+        ponder::UserObject copy(cow);
+        copy.ref<MyClass>().x = 10;
+        REQUIRE(copy.cref<MyClass>().x == 10);
+        REQUIRE(cow.cref<MyClass>().x == 8);
+    }
+
+    SECTION("unshared objects are written in place")
+    {
+        ponder::UserObject copy = ponder::UserObject::makeCopyOnWrite(object);
+        void* before = copy.pointer();
+        copy.set("p", 11);
+        REQUIRE(copy.pointer() == before);
+        REQUIRE(copy.get("p") == ponder::Value(11));
+    }
+
+    SECTION("values share the object")
+    {
+        ponder::Value value(cow);
+        ponder::Value other(value);
+        REQUIRE(other.cref<ponder::UserObject>() == cow);
+
+        other.ref<ponder::UserObject>().set("p", 12);
+        REQUIRE(other.cref<ponder::UserObject>().get("p") == ponder::Value(12));
+        REQUIRE(value.cref<ponder::UserObject>().get("p") == ponder::Value(8));
+    }
+
+    SECTION("reflected calls write the called object")
+    {
+        const ponder::Function& inc = ponder::classByType<MyClass>().function("inc");
+
+        ponder::runtime::call(inc, cow);
+        REQUIRE(cow.cref<MyClass>().x == 9);
+
+        ponder::UserObject copy(cow);
+        ponder::runtime::call(inc, copy);
+        REQUIRE(copy.cref<MyClass>().x == 10);
+        REQUIRE(cow.cref<MyClass>().x == 9);
+
+        ponder::UserObject other(copy);
+        REQUIRE(ponder::runtime::tryCall(inc, other).hasValue());
+        ponder::runtime::callAsync(inc, copy).get();
+        ponder::runtime::ObjectCaller(inc).callBatch(&other, 1, ponder::Args::empty);
+        REQUIRE(copy.cref<MyClass>().x == 11);
+        REQUIRE(other.cref<MyClass>().x == 12);
+        REQUIRE(ponder::runtime::call(ponder::classByType<MyClass>().function("f"), other)
+                == ponder::Value(12));
+        REQUIRE(object.x == 8);
+    }
+
+    SECTION("copies without copy on write share writes")
+    {
+        const ponder::UserObject owned = ponder::UserObject::makeCopy(object);
+        ponder::UserObject copy(owned);
+        copy.set("p", 13);
+        REQUIRE(copy == owned);
+        REQUIRE(owned.get("p") == ponder::Value(13));
+    }
+}
+
 TEST_CASE("User objects can be inspected and modified")
 {
     SECTION("object type information can be inspected")
@@ -458,6 +711,32 @@ TEST_CASE("User objects can be inspected and modified")
         REQUIRE_THROWS_AS(userObject.set(1, 27), ponder::OutOfRange);
     }
 
+    SECTION("we can get and set property values by handle")
+    {
+        const ponder::PropertyHandle handle =
+            ponder::classByType<MyClass>().propertyHandle("p");
+
+        MyClass object(5);
+        ponder::UserObject userObject(&object);
+        REQUIRE(userObject.get(handle) == ponder::Value(5));
+        userObject.set(handle, 9);
+        REQUIRE(object.x == 9);
+        REQUIRE(userObject.get(handle) == ponder::Value(9));
+    }
+
+    SECTION("we can get and set property values by hashed name")
+    {
+        using namespace ponder::literals;
+
+        MyClass object(2);
+        ponder::UserObject userObject(&object);
+        REQUIRE(userObject.get("p"_pid) == ponder::Value(2));
+        userObject.set("p"_pid, 3);
+        REQUIRE(object.x == 3);
+
+        REQUIRE_THROWS_AS(userObject.get("unfound"_pid), ponder::PropertyNotFound);
+    }
+
     SECTION("we can iterate over properties")
     {
         MyClass object(3);